@@ -0,0 +1,138 @@
+#pragma once
+
+#include <stdlib.h>
+#include "object.h"
+
+/**
+ * A region of memory that hands out allocations by bumping a pointer through large blocks, and
+ * frees every allocation at once when it is deleted. Nothing allocated from an Arena is freed on
+ * its own, but memory given back with recycle(...) is reused by the next alloc(...) of the same
+ * size, so a long-lived Arena whose chunks are replaced (by copy-on-write or compaction) does not
+ * keep growing.
+ * 
+ * A DataFrame owns an Arena, and the chunk memory (cells, packed words, validity words) and
+ * Strings of the Columns that the DataFrame creates itself (when loading, opening, querying,
+ * joining, etc.) are carved out of it. This replaces millions of small mallocs and frees with a
+ * few large ones. The Column objects themselves, and everything else they own (chunk tables, zone
+ * maps, StringDictionaries, CompressedChunks), stay on the heap and are deleted by the DataFrame,
+ * so their destructors always run.
+ * 
+ * THREADS: An Arena is NOT thread-safe. Each Task of a parallel load or query allocates from its
+ * own Arena, which is handed to the DataFrame's Arena with adopt(...) once the Task is done.
+ * Chunks freed by deleting a Snapshot are not recycled on the reader's thread, they are retired
+ * and only recycled by the writer in DataFrame::publish() (see snapshot.h).
+ * 
+ * Objects are created inside of an Arena with the placement new below:
+ *      String* s = new (arena) String(arena, "hello");
+ * 
+ * CAUTION: The destructor of an object created inside of an Arena is never run, and such an
+ * object must NOT be deleted. Only objects that keep all of their memory inside the same Arena
+ * (such as a String constructed with that Arena) should be created this way.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Arena : public Object {
+    public:
+    /* The size in bytes of each block, allocations larger than this get a block of their own */
+    static const size_t BLOCK_SIZE = 1024 * 1024;
+
+    /* The alignment in bytes of every allocation */
+    static const size_t ALIGNMENT = 16;
+
+    /* Constructs an empty Arena, no block is allocated until the first alloc(...) */
+    Arena();
+
+    /* Deconstructs the Arena, freeing every allocation made from it */
+    ~Arena();
+
+    /**
+     * Allocates memory from the Arena, which lives until the Arena is deleted.
+     * 
+     * @param bytes - The number of bytes to be allocated
+     * @return A pointer to the memory, aligned to ALIGNMENT bytes
+     */
+    void* alloc(size_t bytes);
+
+    /**
+     * Copies characters into the Arena, followed by a '\0'.
+     * 
+     * @param chars - The characters to be copied
+     * @param length - The number of characters to be copied (not counting any '\0')
+     * @return A pointer to the copied characters inside of the Arena
+     */
+    char* copy(const char* chars, size_t length);
+
+    /**
+     * Gives memory back to the Arena, to be handed out again by the next alloc(...) of the same
+     * number of bytes. Freed memory is kept on one free list for each size, and is only ever
+     * given to the same Arena it came from.
+     * 
+     * @param ptr - Memory returned by alloc(...) of this Arena, which must no longer be used
+     * @param bytes - The number of bytes that were passed to alloc(...)
+     */
+    void recycle(void* ptr, size_t bytes);
+
+    /**
+     * Moves every block and free list of another Arena into this one, leaving the other Arena
+     * empty. Everything allocated from the other Arena then lives until this Arena is deleted.
+     * 
+     * NOTE: Neither Arena may be used by any other thread while this runs.
+     * 
+     * @param other - The Arena to be emptied into this one, which can then be deleted
+     */
+    void adopt(Arena* other);
+
+    /**
+     * Returns the number of bytes handed out by the Arena.
+     * 
+     * @return The total size of every alloc(...) and copy(...)
+     */
+    size_t size();
+
+    /**
+     * Returns the number of bytes of every block allocated by the Arena.
+     * 
+     * @return The memory held by the Arena
+     */
+    size_t capacity();
+
+    protected:
+    /* The blocks allocated by the Arena, each one freed when the Arena is deleted */
+    char** blocks_;
+
+    /* The number of blocks inside of blocks_ */
+    size_t num_blocks_;
+
+    /* The number of block pointers blocks_ can hold before it must grow */
+    size_t blocks_capacity_;
+
+    /* The next free byte of the current block */
+    char* next_;
+
+    /* The byte after the end of the current block */
+    char* end_;
+
+    /* The number of bytes handed out */
+    size_t size_;
+
+    /* The number of bytes of every block */
+    size_t capacity_;
+
+    /* The recycled memory of each size, as a list of (size, first free) pairs linked through the
+     * freed memory itself */
+    class FreeList* free_lists_;
+};
+
+/**
+ * Creates an object inside of an Arena, as in: new (arena) String(arena, "hello")
+ * 
+ * @param size - The size of the object
+ * @param arena - The Arena the object is carved from
+ * @return The memory for the object
+ */
+void* operator new(size_t size, Arena* arena);
+
+/* Only called if the constructor of an object created inside of an Arena throws, does nothing */
+void operator delete(void* ptr, Arena* arena);
@@ -0,0 +1,589 @@
+/**
+ * Benchmarks for the DataFrame and Column API, run on synthetic data from a Generator.
+ * 
+ * Every case prints one line of JSON (see bench.h), so runs can be saved and compared:
+ *      ./bench --rows 1000000 --types IFBSP --cardinality 1000 --seed 42 > run.jsonl
+ * 
+ * Options:
+ *      --rows N         The number of rows of the generated DataFrame (default 1000000)
+ *      --types MIX      One letter per column, I/F/B/S/P (default IFBSP), see generator.h
+ *      --cardinality K  The number of distinct Strings of a StringColumn (default 1000)
+ *      --seed S         The seed of the Generator, the same seed gives the same data (default 42)
+ *      --samples N      The number of samples of each case (default 100)
+ *      --batch N        The number of operations timed by each sample (default 1024)
+ *      --threads N      The most threads used by the scaling cases (default 32), which are also
+ *                       capped at the number of morsels of the DataFrame (see MORSEL_SIZE)
+ *      --case NAME      Only run the cases whose name contains NAME
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "generator.h"
+#include "../dataframe.h"
+#include "../groupby.h"
+#include "../scan.h"
+#include "../snapshot.h"
+#include "../threadpool.h"
+
+/* The settings of a run, from the command line */
+class Settings {
+    public:
+    size_t rows = 1000000;
+    const char* types = "IFBSP";
+    size_t cardinality = 1000;
+    uint64_t seed = 42;
+    size_t samples = 100;
+    size_t batch = 1024;
+    size_t threads = 32;
+    const char* filter = nullptr;
+
+    /* Returns whether the case with this name should be run */
+    bool selected(const char* name) {
+        return this->filter == nullptr || strstr(name, this->filter) != nullptr;
+    }
+
+    /* Returns a new Generator for these settings */
+    Generator* generator() {
+        return new Generator(this->rows, this->types, this->cardinality, this->seed);
+    }
+};
+
+/* Finds the first column of a DataFrame of a type ('I', 'F', 'B', 'S' or 'P'), or ncol() */
+size_t find_column(DataFrame* df, char type) {
+    for (size_t ii = 0; ii < df->ncol(); ii++) {
+        if ((type == 'I' && df->is_int_column(ii)) || (type == 'F' && df->is_float_column(ii))
+            || (type == 'B' && df->is_bool_column(ii))) {
+            return ii;
+        }
+        if ((type == 'S' || type == 'P') && df->is_string_column(ii)
+            && df->as_string_column(ii)->is_encoded() == (type == 'S')) {
+            return ii;
+        }
+    }
+    return df->ncol();
+}
+
+/* Fills rows with random row indices of a DataFrame */
+void random_rows(Generator* gen, size_t nrow, size_t* rows, size_t num_rows) {
+    for (size_t ii = 0; ii < num_rows; ii++) {
+        rows[ii] = (size_t)(gen->next() % (uint64_t)nrow);
+    }
+}
+
+/* Building a whole DataFrame from generated data with bulk appends */
+void bench_construct(Settings* s) {
+    if (!s->selected("construct")) return;
+    Bench b("construct", s->rows, s->samples);
+    size_t reps = s->samples < 10 ? s->samples : 10;
+    for (size_t ii = 0; ii < reps; ii++) {
+        Generator* gen = s->generator();
+        b.start();
+        DataFrame* df = gen->make_frame();
+        b.stop(s->rows);
+        Generator::delete_frame(df);
+        delete gen;
+    }
+    b.report();
+}
+
+/* get_*(...) and set(...) on one column, in row order and in random order */
+void bench_get_set(Settings* s, DataFrame* df, Generator* gen) {
+    size_t int_col = find_column(df, 'I');
+    size_t float_col = find_column(df, 'F');
+    size_t nrow = df->nrow();
+    size_t* rows = new size_t[s->batch];
+    volatile long sink = 0;
+
+    if (int_col < df->ncol() && s->selected("get_int_sequential")) {
+        Bench b("get_int_sequential", nrow, s->samples);
+        for (size_t ii = 0; ii < s->samples; ii++) {
+            size_t first = (ii * s->batch) % (nrow - s->batch + 1);
+            b.start();
+            for (size_t jj = 0; jj < s->batch; jj++) sink += df->get_int(first + jj, int_col);
+            b.stop(s->batch);
+        }
+        b.report();
+    }
+    if (int_col < df->ncol() && s->selected("get_int_random")) {
+        Bench b("get_int_random", nrow, s->samples);
+        for (size_t ii = 0; ii < s->samples; ii++) {
+            random_rows(gen, nrow, rows, s->batch);
+            b.start();
+            for (size_t jj = 0; jj < s->batch; jj++) sink += df->get_int(rows[jj], int_col);
+            b.stop(s->batch);
+        }
+        b.report();
+    }
+    if (int_col < df->ncol() && s->selected("set_int_sequential")) {
+        Bench b("set_int_sequential", nrow, s->samples);
+        for (size_t ii = 0; ii < s->samples; ii++) {
+            size_t first = (ii * s->batch) % (nrow - s->batch + 1);
+            b.start();
+            for (size_t jj = 0; jj < s->batch; jj++) df->set(first + jj, int_col, (int)jj);
+            b.stop(s->batch);
+        }
+        b.report();
+    }
+    if (int_col < df->ncol() && s->selected("set_int_random")) {
+        Bench b("set_int_random", nrow, s->samples);
+        for (size_t ii = 0; ii < s->samples; ii++) {
+            random_rows(gen, nrow, rows, s->batch);
+            b.start();
+            for (size_t jj = 0; jj < s->batch; jj++) df->set(rows[jj], int_col, (int)jj);
+            b.stop(s->batch);
+        }
+        b.report();
+    }
+    if (float_col < df->ncol() && s->selected("get_float_random")) {
+        Bench b("get_float_random", nrow, s->samples);
+        for (size_t ii = 0; ii < s->samples; ii++) {
+            random_rows(gen, nrow, rows, s->batch);
+            b.start();
+            for (size_t jj = 0; jj < s->batch; jj++) {
+                sink += (long)df->get_float(rows[jj], float_col);
+            }
+            b.stop(s->batch);
+        }
+        b.report();
+    }
+    if (float_col < df->ncol() && s->selected("set_float_random")) {
+        Bench b("set_float_random", nrow, s->samples);
+        for (size_t ii = 0; ii < s->samples; ii++) {
+            random_rows(gen, nrow, rows, s->batch);
+            b.start();
+            for (size_t jj = 0; jj < s->batch; jj++) df->set(rows[jj], float_col, (float)jj);
+            b.stop(s->batch);
+        }
+        b.report();
+    }
+    delete[] rows;
+}
+
+/* add_row(...) and remove_row(...) at the head, middle and tail of a fresh DataFrame */
+void bench_add_remove(Settings* s) {
+    const char* positions[3] = {"head", "middle", "tail"};
+    char name[64];
+    for (size_t pos = 0; pos < 3; pos++) {
+        snprintf(name, sizeof(name), "add_row_%s", positions[pos]);
+        if (s->selected(name)) {
+            Generator* gen = s->generator();
+            DataFrame* df = gen->make_frame();
+            Bench b(name, s->rows, s->samples);
+            for (size_t ii = 0; ii < s->samples; ii++) {
+                b.start();
+                for (size_t jj = 0; jj < s->batch; jj++) {
+                    if (pos == 2) {
+                        df->add_row();
+                    } else {
+                        df->add_row(pos == 0 ? 0 : df->nrow() / 2);
+                    }
+                }
+                b.stop(s->batch);
+            }
+            b.report();
+            Generator::delete_frame(df);
+            delete gen;
+        }
+        snprintf(name, sizeof(name), "remove_row_%s", positions[pos]);
+        if (s->selected(name)) {
+            Generator* gen = s->generator();
+            DataFrame* df = gen->make_frame();
+            Bench b(name, s->rows, s->samples);
+            for (size_t ii = 0; ii < s->samples && df->nrow() > s->batch; ii++) {
+                b.start();
+                for (size_t jj = 0; jj < s->batch; jj++) {
+                    size_t nrow = df->nrow();
+                    df->remove_row(pos == 0 ? 0 : (pos == 1 ? nrow / 2 : nrow - 1));
+                }
+                b.stop(s->batch);
+            }
+            b.report();
+            Generator::delete_frame(df);
+            delete gen;
+        }
+    }
+}
+
+/* insert(...) of a small DataFrame in the middle, and get_row(...) at random rows */
+void bench_insert_get_row(Settings* s, DataFrame* df, Generator* gen) {
+    if (s->selected("insert_middle")) {
+        Generator* small_gen = new Generator(s->batch, s->types, s->cardinality, s->seed + 1);
+        DataFrame* small = small_gen->make_frame();
+        Generator* big_gen = s->generator();
+        DataFrame* big = big_gen->make_frame();
+        Bench b("insert_middle", s->rows, s->samples);
+        size_t reps = s->samples < 10 ? s->samples : 10;
+        for (size_t ii = 0; ii < reps; ii++) {
+            b.start();
+            big->insert(big->nrow() / 2, small);
+            b.stop(s->batch);
+        }
+        b.report();
+        Generator::delete_frame(big);
+        Generator::delete_frame(small);
+        delete big_gen;
+        delete small_gen;
+    }
+    if (s->selected("get_row_random")) {
+        size_t* rows = new size_t[s->batch];
+        Bench b("get_row_random", df->nrow(), s->samples);
+        for (size_t ii = 0; ii < s->samples; ii++) {
+            random_rows(gen, df->nrow(), rows, s->batch);
+            b.start();
+            for (size_t jj = 0; jj < s->batch; jj++) delete df->get_row(rows[jj]);
+            b.stop(s->batch);
+        }
+        b.report();
+        delete[] rows;
+    }
+}
+
+/* Every query(...) overload, and Column::equals(...) of every column of two identical DataFrames */
+void bench_query_equals(Settings* s, DataFrame* df) {
+    size_t reps = s->samples < 20 ? s->samples : 20;
+    size_t int_col = find_column(df, 'I');
+    size_t float_col = find_column(df, 'F');
+    size_t bool_col = find_column(df, 'B');
+    size_t string_col = find_column(df, 'S');
+    size_t plain_col = find_column(df, 'P');
+    if (int_col < df->ncol() && s->selected("query_int")) {
+        Bench b("query_int", df->nrow(), reps);
+        for (size_t ii = 0; ii < reps; ii++) {
+            b.start();
+            delete df->query(int_col, 7);
+            b.stop(df->nrow());
+        }
+        b.report();
+    }
+    if (float_col < df->ncol() && s->selected("query_float")) {
+        float value = df->get_float(0, float_col);
+        Bench b("query_float", df->nrow(), reps);
+        for (size_t ii = 0; ii < reps; ii++) {
+            b.start();
+            delete df->query(float_col, value);
+            b.stop(df->nrow());
+        }
+        b.report();
+    }
+    if (bool_col < df->ncol() && s->selected("query_bool")) {
+        Bench b("query_bool", df->nrow(), reps);
+        for (size_t ii = 0; ii < reps; ii++) {
+            b.start();
+            delete df->query(bool_col, true);
+            b.stop(df->nrow());
+        }
+        b.report();
+    }
+    if (string_col < df->ncol() && s->selected("query_string")) {
+        String* value = new String("s7");
+        Bench b("query_string", df->nrow(), reps);
+        for (size_t ii = 0; ii < reps; ii++) {
+            b.start();
+            delete df->query(string_col, value);
+            b.stop(df->nrow());
+        }
+        b.report();
+        delete value;
+    }
+    if (plain_col < df->ncol() && s->selected("query_string_plain")) {
+        String* value = new String("s7");
+        Bench b("query_string_plain", df->nrow(), reps);
+        for (size_t ii = 0; ii < reps; ii++) {
+            b.start();
+            delete df->query(plain_col, value);
+            b.stop(df->nrow());
+        }
+        b.report();
+        delete value;
+    }
+    if (s->selected("equals")) {
+        Generator* gen = s->generator();
+        DataFrame* a = gen->make_frame();
+        delete gen;
+        gen = s->generator();
+        DataFrame* b_df = gen->make_frame();
+        delete gen;
+        volatile size_t sink = 0;
+        Bench b("equals", s->rows, reps);
+        for (size_t ii = 0; ii < reps; ii++) {
+            b.start();
+            for (size_t jj = 0; jj < a->ncol(); jj++) {
+                sink += a->get_column(jj)->equals(b_df->get_column(jj));
+            }
+            b.stop(s->rows * a->ncol());
+        }
+        b.report();
+        Generator::delete_frame(a);
+        Generator::delete_frame(b_df);
+    }
+}
+
+/* Appending ints one at a time to an IntColumn, against a plain doubling array */
+void bench_append_vs_doubling(Settings* s) {
+    if (s->selected("append_int_column")) {
+        Bench b("append_int_column", s->rows, s->samples);
+        size_t reps = s->samples < 10 ? s->samples : 10;
+        for (size_t ii = 0; ii < reps; ii++) {
+            IntColumn* ic = new IntColumn();
+            b.start();
+            for (size_t jj = 0; jj < s->rows; jj++) {
+                ic->add_row();
+                ic->put(jj, (int)jj);
+            }
+            b.stop(s->rows);
+            delete ic;
+        }
+        b.report();
+    }
+    if (s->selected("append_doubling_array")) {
+        Bench b("append_doubling_array", s->rows, s->samples);
+        size_t reps = s->samples < 10 ? s->samples : 10;
+        for (size_t ii = 0; ii < reps; ii++) {
+            size_t capacity = 16;
+            size_t length = 0;
+            int* array = new int[capacity];
+            b.start();
+            for (size_t jj = 0; jj < s->rows; jj++) {
+                if (length == capacity) {
+                    int* bigger = new int[capacity * 2];
+                    memcpy(bigger, array, capacity * sizeof(int));
+                    delete[] array;
+                    array = bigger;
+                    capacity *= 2;
+                }
+                array[length++] = (int)jj;
+            }
+            b.stop(s->rows);
+            delete[] array;
+        }
+        b.report();
+    }
+}
+
+/* Finding matching ints with a virtual get_int(...) per cell, against IntColumn::match(...) */
+void bench_scan(Settings* s, DataFrame* df) {
+    size_t int_col = find_column(df, 'I');
+    if (int_col == df->ncol()) return;
+    size_t reps = s->samples < 20 ? s->samples : 20;
+    Column* c = df->get_column(int_col);
+    if (s->selected("scan_int_virtual")) {
+        Bench b("scan_int_virtual", df->nrow(), reps);
+        for (size_t ii = 0; ii < reps; ii++) {
+            Bitmap* matches = new Bitmap(c->size());
+            b.start();
+            for (size_t jj = 0; jj < c->size(); jj++) {
+                if (c->get_int(jj) == 7) matches->set(jj, true);
+            }
+            b.stop(c->size());
+            delete matches;
+        }
+        b.report();
+    }
+    const char* paths[3] = {"scan_int_scalar", "scan_int_sse2", "scan_int_avx2"};
+    ScanPath best = get_scan_path();
+    for (int path = SCALAR_SCAN; path <= (int)best; path++) {
+        if (!s->selected(paths[path])) continue;
+        set_scan_path((ScanPath)path);
+        Bench b(paths[path], df->nrow(), reps);
+        for (size_t ii = 0; ii < reps; ii++) {
+            b.start();
+            Bitmap* matches = df->as_int_column(int_col)->match(7);
+            b.stop(c->size());
+            delete matches;
+        }
+        b.report();
+    }
+    set_scan_path(best);
+}
+
+/* query(...) on an IntColumn with 1, 2, 4, ... threads, up to one thread per morsel */
+void bench_query_scaling(Settings* s, DataFrame* df) {
+    size_t int_col = find_column(df, 'I');
+    if (int_col == df->ncol()) return;
+    size_t reps = s->samples < 20 ? s->samples : 20;
+    size_t morsels = (df->nrow() + DataFrame::MORSEL_SIZE - 1) / DataFrame::MORSEL_SIZE;
+    if (s->threads > morsels) {
+        fprintf(stderr, "query_int_threads: only %zu morsels, so at most %zu threads are timed "
+            "(raise --rows for more)\n", morsels, morsels);
+    }
+    char name[64];
+    for (size_t threads = 1; threads <= s->threads && threads <= morsels; threads *= 2) {
+        snprintf(name, sizeof(name), "query_int_threads_%zu", threads);
+        if (!s->selected(name)) continue;
+        ThreadPool* pool = new ThreadPool(threads);
+        df->set_thread_pool(pool);
+        Bench b(name, df->nrow(), reps);
+        for (size_t ii = 0; ii < reps; ii++) {
+            b.start();
+            delete df->query(int_col, 7);
+            b.stop(df->nrow());
+        }
+        b.report();
+        df->set_thread_pool(nullptr);
+        delete pool;
+    }
+}
+
+/* The README loop adding 5.0 to every float, against FloatColumn::apply(...) */
+void bench_add_float(Settings* s, DataFrame* df) {
+    size_t float_col = find_column(df, 'F');
+    if (float_col == df->ncol()) return;
+    size_t reps = s->samples < 20 ? s->samples : 20;
+    if (s->selected("add_float_readme_loop")) {
+        Bench b("add_float_readme_loop", df->nrow(), reps);
+        for (size_t ii = 0; ii < reps; ii++) {
+            b.start();
+            for (size_t jj = 0; jj < df->nrow(); jj++) {
+                float f = df->get_float(jj, float_col);
+                f += 5.0;
+                df->set(jj, float_col, f);
+            }
+            b.stop(df->nrow());
+        }
+        b.report();
+    }
+    if (s->selected("add_float_apply")) {
+        Bench b("add_float_apply", df->nrow(), reps);
+        for (size_t ii = 0; ii < reps; ii++) {
+            b.start();
+            df->as_float_column(float_col)->apply(ADD_ARITH, (float)5.0);
+            b.stop(df->nrow());
+        }
+        b.report();
+    }
+}
+
+/* group_by(...) on an IntColumn key, summing a FloatColumn */
+void bench_group_by(Settings* s, DataFrame* df) {
+    size_t int_col = find_column(df, 'I');
+    size_t float_col = find_column(df, 'F');
+    if (int_col == df->ncol() || float_col == df->ncol() || !s->selected("group_by_sum")) return;
+    size_t reps = s->samples < 10 ? s->samples : 10;
+    Bench b("group_by_sum", df->nrow(), reps);
+    for (size_t ii = 0; ii < reps; ii++) {
+        GroupBy* gb = df->group_by(&int_col, 1);
+        b.start();
+        DataFrame* result = gb->agg(SUM_AGG, float_col)->agg(COUNT_AGG, float_col)->result();
+        b.stop(df->nrow());
+        delete result;
+        delete gb;
+    }
+    b.report();
+}
+
+/* The shared state of the snapshot case's writer thread */
+class Writer {
+    public:
+    DataFrame* df;
+    size_t col;
+    int stop;
+};
+
+/* Appends rows as fast as possible, publishing every 1024 rows, until stop is set */
+void* write_rows(void* arg) {
+    Writer* w = (Writer*)arg;
+    int value = 0;
+    while (!__atomic_load_n(&w->stop, __ATOMIC_ACQUIRE)) {
+        w->df->add_row();
+        w->df->set(w->df->nrow() - 1, w->col, value++);
+        if (value % 1024 == 0) w->df->publish();
+    }
+    return nullptr;
+}
+
+/* Reading through snapshot() while another thread appends rows at full rate */
+void bench_snapshot(Settings* s) {
+    if (!s->selected("snapshot_read_under_writes")) return;
+    Generator* gen = s->generator();
+    DataFrame* df = gen->make_frame();
+    size_t int_col = find_column(df, 'I');
+    if (int_col < df->ncol()) {
+        df->publish();
+        Writer w;
+        w.df = df;
+        w.col = int_col;
+        w.stop = 0;
+        pthread_t writer;
+        pthread_create(&writer, nullptr, write_rows, &w);
+        size_t* rows = new size_t[s->batch];
+        volatile long sink = 0;
+        Bench b("snapshot_read_under_writes", s->rows, s->samples);
+        for (size_t ii = 0; ii < s->samples; ii++) {
+            /* The writer only appends, so rows below the first nrow() are in every Snapshot */
+            random_rows(gen, s->rows, rows, s->batch);
+            b.start();
+            Snapshot* snap = df->snapshot();
+            for (size_t jj = 0; jj < s->batch; jj++) sink += snap->get_int(rows[jj], int_col);
+            delete snap;
+            b.stop(s->batch);
+        }
+        __atomic_store_n(&w.stop, 1, __ATOMIC_RELEASE);
+        pthread_join(writer, nullptr);
+        b.report();
+        delete[] rows;
+    }
+    Generator::delete_frame(df);
+    delete gen;
+}
+
+int main(int argc, char** argv) {
+    Settings s;
+    for (int ii = 1; ii < argc; ii += 2) {
+        if (ii + 1 == argc) {
+            fprintf(stderr, "option %s needs a value\n", argv[ii]);
+            return 1;
+        }
+        if (strcmp(argv[ii], "--rows") == 0) s.rows = strtoull(argv[ii + 1], nullptr, 10);
+        else if (strcmp(argv[ii], "--types") == 0) s.types = argv[ii + 1];
+        else if (strcmp(argv[ii], "--cardinality") == 0) {
+            s.cardinality = strtoull(argv[ii + 1], nullptr, 10);
+        }
+        else if (strcmp(argv[ii], "--seed") == 0) s.seed = strtoull(argv[ii + 1], nullptr, 10);
+        else if (strcmp(argv[ii], "--samples") == 0) {
+            s.samples = strtoull(argv[ii + 1], nullptr, 10);
+        }
+        else if (strcmp(argv[ii], "--batch") == 0) s.batch = strtoull(argv[ii + 1], nullptr, 10);
+        else if (strcmp(argv[ii], "--threads") == 0) {
+            s.threads = strtoull(argv[ii + 1], nullptr, 10);
+        }
+        else if (strcmp(argv[ii], "--case") == 0) s.filter = argv[ii + 1];
+        else {
+            fprintf(stderr, "unknown option %s\n", argv[ii]);
+            return 1;
+        }
+    }
+    char bad_type = Generator::valid_types(s.types);
+    if (bad_type != '\0') {
+        fprintf(stderr, "unknown column type '%c' in --types, use I, F, B, S or P\n", bad_type);
+        return 1;
+    }
+    if (s.rows < s.batch || s.cardinality == 0 || s.seed == 0 || s.types[0] == '\0') {
+        fprintf(stderr, "rows must be at least batch, and cardinality, seed and types must not "
+            "be empty\n");
+        return 1;
+    }
+
+    bench_construct(&s);
+    Generator* gen = s.generator();
+    DataFrame* df = gen->make_frame();
+    bench_get_set(&s, df, gen);
+    bench_insert_get_row(&s, df, gen);
+    bench_query_equals(&s, df);
+    bench_scan(&s, df);
+    bench_query_scaling(&s, df);
+    bench_group_by(&s, df);
+    bench_add_float(&s, df);
+    Generator::delete_frame(df);
+    delete gen;
+    bench_add_remove(&s);
+    bench_append_vs_doubling(&s);
+    bench_snapshot(&s);
+    return 0;
+}
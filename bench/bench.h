@@ -0,0 +1,122 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * Times one benchmark case and reports it as a single line of JSON.
+ * 
+ * A case is run as a number of samples, and each sample times a batch of operations (such as
+ * 1024 calls to get_int(...)). The latency of one operation in a sample is the time of the
+ * sample divided by its number of operations, and p50/p99 are taken over the samples.
+ * Example output:
+ *      {"case": "get_int_random", "rows": 1000000, "samples": 100, "ops": 102400,
+ *       "ops_per_sec": 81234567.0, "p50_ns": 11.8, "p99_ns": 14.2}
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Bench {
+    public:
+    /* The name of the case */
+    const char* name;
+
+    /* The number of rows of the DataFrame the case runs on */
+    size_t rows;
+
+    /* The nanoseconds per operation of each sample */
+    double* samples;
+
+    /* The number of samples recorded, and the number samples can hold */
+    size_t num_samples;
+    size_t capacity;
+
+    /* The total number of operations and nanoseconds of every sample */
+    size_t total_ops;
+    double total_nanos;
+
+    /* When the current sample was started */
+    uint64_t start_nanos;
+
+    /**
+     * Constructs a Bench for one case.
+     * 
+     * @param name - The name of the case
+     * @param rows - The number of rows of the DataFrame the case runs on
+     * @param max_samples - The most samples that will be recorded
+     */
+    Bench(const char* name, size_t rows, size_t max_samples) {
+        this->name = name;
+        this->rows = rows;
+        this->samples = new double[max_samples];
+        this->num_samples = 0;
+        this->capacity = max_samples;
+        this->total_ops = 0;
+        this->total_nanos = 0;
+        this->start_nanos = 0;
+    }
+
+    ~Bench() {
+        delete[] this->samples;
+    }
+
+    /* Returns the time of the monotonic clock, in nanoseconds */
+    static uint64_t now() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+    }
+
+    /* Starts timing a sample */
+    void start() {
+        this->start_nanos = now();
+    }
+
+    /**
+     * Stops timing a sample, and records it.
+     * 
+     * @param ops - The number of operations run during the sample
+     */
+    void stop(size_t ops) {
+        double nanos = (double)(now() - this->start_nanos);
+        if (this->num_samples < this->capacity && ops > 0) {
+            this->samples[this->num_samples++] = nanos / (double)ops;
+        }
+        this->total_ops += ops;
+        this->total_nanos += nanos;
+    }
+
+    /* Compares two doubles for qsort(...) */
+    static int compare(const void* a, const void* b) {
+        double x = *(const double*)a;
+        double y = *(const double*)b;
+        return (x > y) - (x < y);
+    }
+
+    /**
+     * Gets a percentile of the nanoseconds per operation over every sample.
+     * 
+     * @param percentile - Between 0 and 100
+     * @return The nanoseconds per operation, or 0 if there are no samples
+     */
+    double percentile(double percentile) {
+        if (this->num_samples == 0) return 0;
+        qsort(this->samples, this->num_samples, sizeof(double), compare);
+        size_t index = (size_t)(percentile / 100.0 * (double)(this->num_samples - 1) + 0.5);
+        return this->samples[index];
+    }
+
+    /* Prints the case as a single line of JSON */
+    void report() {
+        double ops_per_sec = this->total_nanos > 0
+            ? (double)this->total_ops * 1e9 / this->total_nanos : 0;
+        printf("{\"case\": \"%s\", \"rows\": %zu, \"samples\": %zu, \"ops\": %zu, "
+            "\"ops_per_sec\": %.1f, \"p50_ns\": %.1f, \"p99_ns\": %.1f}\n",
+            this->name, this->rows, this->num_samples, this->total_ops, ops_per_sec,
+            percentile(50), percentile(99));
+        fflush(stdout);
+    }
+};
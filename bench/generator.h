@@ -0,0 +1,191 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../dataframe.h"
+
+/**
+ * Generates synthetic DataFrames for the benchmarks, so that every run with the same settings
+ * and seed builds exactly the same data.
+ * 
+ * The type mix is a string with one letter per column: 'I' for an IntColumn, 'F' for a
+ * FloatColumn, 'B' for a BoolColumn, 'S' for a dictionary-encoded StringColumn (see
+ * StringColumn::encode()) and 'P' for a plain StringColumn. Any other letter is rejected by
+ * valid_types(...). Ints are uniform in
+ * [0, int_range), floats are uniform in [0, 1), Booleans are true half the time, and Strings
+ * are chosen uniformly from string_cardinality distinct values ("s0", "s1", ...).
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Generator {
+    public:
+    /* The number of rows of each generated DataFrame */
+    size_t rows;
+
+    /* One letter per column, see above */
+    const char* types;
+
+    /* The number of distinct Strings of a StringColumn */
+    size_t string_cardinality;
+
+    /* Ints are generated in [0, int_range) */
+    int int_range;
+
+    /* The current state of the xorshift64 generator */
+    uint64_t state;
+
+    /**
+     * Constructs a Generator.
+     * 
+     * @param rows - The number of rows of each generated DataFrame
+     * @param types - One letter per column, see above
+     * @param string_cardinality - The number of distinct Strings of a StringColumn
+     * @param seed - The seed of the random numbers, which must not be 0
+     */
+    Generator(size_t rows, const char* types, size_t string_cardinality, uint64_t seed) {
+        this->rows = rows;
+        this->types = types;
+        this->string_cardinality = string_cardinality;
+        this->int_range = 1000;
+        this->state = seed;
+    }
+
+    /**
+     * Checks a type mix before any Column is generated.
+     * 
+     * @param types - One letter per column, see above
+     * @return The first letter that is not 'I', 'F', 'B', 'S' or 'P', or '\0' if every letter is
+     */
+    static char valid_types(const char* types) {
+        for (size_t ii = 0; types[ii] != '\0'; ii++) {
+            if (strchr("IFBSP", types[ii]) == nullptr) return types[ii];
+        }
+        return '\0';
+    }
+
+    /* Returns the next random number of the xorshift64 generator */
+    uint64_t next() {
+        this->state ^= this->state << 13;
+        this->state ^= this->state >> 7;
+        this->state ^= this->state << 17;
+        return this->state;
+    }
+
+    /* Returns a random int in [0, int_range) */
+    int next_int() {
+        return (int)(next() % (uint64_t)this->int_range);
+    }
+
+    /* Returns a random float in [0, 1) */
+    float next_float() {
+        return (float)(next() >> 40) / (float)(1 << 24);
+    }
+
+    /* Returns a random Boolean */
+    bool next_bool() {
+        return (next() >> 63) != 0;
+    }
+
+    /* Returns a new String chosen from the string_cardinality distinct values */
+    String* next_string() {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "s%zu", (size_t)(next() % this->string_cardinality));
+        return new String(buffer);
+    }
+
+    /**
+     * Generates a Column of a type, filled in bulk with append(...).
+     * 
+     * NOTE: If the type is not 'I', 'F', 'B', 'S' or 'P', then the benchmark exits with an error.
+     * 
+     * @param type - 'I', 'F', 'B', 'S' or 'P'
+     * @param num_rows - The number of cells of the Column
+     * @return A new Column, so care should be taken to delete it
+     */
+    Column* make_column(char type, size_t num_rows) {
+        size_t batch = Column::CHUNK_SIZE;
+        if (type == 'I') {
+            IntColumn* ic = new IntColumn();
+            int* values = new int[batch];
+            for (size_t ii = 0; ii < num_rows; ii += batch) {
+                size_t n = num_rows - ii < batch ? num_rows - ii : batch;
+                for (size_t jj = 0; jj < n; jj++) values[jj] = next_int();
+                ic->append(values, n);
+            }
+            delete[] values;
+            return ic;
+        }
+        if (type == 'F') {
+            FloatColumn* fc = new FloatColumn();
+            float* values = new float[batch];
+            for (size_t ii = 0; ii < num_rows; ii += batch) {
+                size_t n = num_rows - ii < batch ? num_rows - ii : batch;
+                for (size_t jj = 0; jj < n; jj++) values[jj] = next_float();
+                fc->append(values, n);
+            }
+            delete[] values;
+            return fc;
+        }
+        if (type == 'B') {
+            BoolColumn* bc = new BoolColumn();
+            bool* values = new bool[batch];
+            for (size_t ii = 0; ii < num_rows; ii += batch) {
+                size_t n = num_rows - ii < batch ? num_rows - ii : batch;
+                for (size_t jj = 0; jj < n; jj++) values[jj] = next_bool();
+                bc->append(values, n);
+            }
+            delete[] values;
+            return bc;
+        }
+        if (type != 'S' && type != 'P') {
+            fprintf(stderr, "unknown column type '%c'\n", type);
+            exit(1);
+        }
+        StringColumn* sc = new StringColumn();
+        if (type == 'S') sc->encode();
+        String** values = new String*[batch];
+        for (size_t ii = 0; ii < num_rows; ii += batch) {
+            size_t n = num_rows - ii < batch ? num_rows - ii : batch;
+            for (size_t jj = 0; jj < n; jj++) values[jj] = next_string();
+            sc->append(values, n);
+            for (size_t jj = 0; jj < n; jj++) delete values[jj];
+        }
+        delete[] values;
+        return sc;
+    }
+
+    /**
+     * Generates a DataFrame with one Column per letter of types.
+     * 
+     * NOTE: The DataFrame does not own its Columns, so it must be deleted with
+     * delete_frame(...).
+     * 
+     * @return A new DataFrame of rows rows
+     */
+    DataFrame* make_frame() {
+        size_t ncol = strlen(this->types);
+        DataFrame* df = new DataFrame(make_column(this->types[0], this->rows));
+        for (size_t ii = 1; ii < ncol; ii++) {
+            df->add_column(ii - 1, make_column(this->types[ii], this->rows));
+        }
+        return df;
+    }
+
+    /**
+     * Deletes a DataFrame made by make_frame(), and its Columns.
+     * 
+     * @param df - The DataFrame to be deleted
+     */
+    static void delete_frame(DataFrame* df) {
+        size_t ncol = df->ncol();
+        Column** columns = new Column*[ncol];
+        for (size_t ii = 0; ii < ncol; ii++) columns[ii] = df->get_column(ii);
+        delete df;
+        for (size_t ii = 0; ii < ncol; ii++) delete columns[ii];
+        delete[] columns;
+    }
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <stdint.h>
+#include "object.h"
+
+/**
+ * A fixed length sequence of bits, packed into 64-bit words. A Bitmap is used to mark a set of
+ * rows of a Column or DataFrame, where bit r being set means that row r is selected.
+ * 
+ * Row r is bit (r % 64) of word (r / 64). Any bits past the last row of the last word are always
+ * kept at 0, so whole words can be counted and combined without checking the length.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Bitmap : public Object {
+    public:
+    /**
+     * Constructs a Bitmap with every bit set to 0.
+     * 
+     * @param size - The number of bits inside of the Bitmap
+     */
+    Bitmap(size_t size);
+
+    /* Deconstructs the Bitmap */
+    ~Bitmap();
+
+    /**
+     * Determines if another object is equal to this one.
+     * 
+     * @param obj - The Object that will be compared 
+     * @return For a Bitmap to equal another Bitmap, they must have the same size and the same bits
+     * set.
+     */
+    bool equals(Object* const obj);
+
+    /* Inherited from Object, generates a hash for a Bitmap */
+    size_t hash();
+
+    /**
+     * Returns the number of bits inside of the Bitmap.
+     * 
+     * @return The total length of the Bitmap
+     */
+    size_t size();
+
+    /**
+     * Gets a bit from the Bitmap.
+     * 
+     * NOTE: If the index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param index - The numbered bit of the Bitmap (starting at 0)
+     * @return True if the bit is set, false otherwise
+     */
+    bool get(size_t index);
+
+    /**
+     * Sets a bit inside of the Bitmap.
+     * 
+     * NOTE: If the index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param index - The numbered bit of the Bitmap (starting at 0)
+     * @param value - True to set the bit, false to clear it
+     */
+    void set(size_t index, bool value);
+
+    /**
+     * Counts the number of set bits inside of the Bitmap with a hardware popcount.
+     * 
+     * @return The number of bits that are set
+     */
+    size_t count();
+
+    /**
+     * Returns the number of 64-bit words that make up the Bitmap.
+     * 
+     * @return The number of words, which is size() / 64 rounded up
+     */
+    size_t num_words();
+
+    /**
+     * Gets the packed words of the Bitmap, which may be written to directly.
+     * 
+     * CAUTION: Any bits past size() in the last word MUST be left at 0.
+     * 
+     * @return A pointer to the first of the num_words() words
+     */
+    uint64_t* get_words();
+
+    /**
+     * Keeps only the bits that are set in both this Bitmap and another one.
+     * 
+     * NOTE: If the Bitmaps are not the same size, then an "error" will be thrown.
+     * 
+     * @param other - The Bitmap to intersect with
+     */
+    void and_with(Bitmap* other);
+
+    /**
+     * Sets every bit that is set in either this Bitmap or another one.
+     * 
+     * NOTE: If the Bitmaps are not the same size, then an "error" will be thrown.
+     * 
+     * @param other - The Bitmap to union with
+     */
+    void or_with(Bitmap* other);
+
+    /* Flips every bit inside of the Bitmap */
+    void invert();
+
+    protected:
+    /* The number of bits inside of the Bitmap */
+    size_t size_;
+
+    /* The packed bits, (size_ + 63) / 64 words long */
+    uint64_t* words_;
+};
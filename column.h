@@ -1,8 +1,20 @@
 #pragma once
 
+#include <assert.h>
 #include <stdarg.h>
+#include <stdint.h>
 #include "string.h"
 #include "object.h"
+#include "bitmap.h"
+#include "dictionary.h"
+#include "datafile.h"
+#include "kernels.h"
+#include "compression.h"
+#include "threadpool.h"
+#include "stats.h"
+
+class ColumnIndex;
+class FloatColumn;
 
 /**
  * An abstract Column that mainly stores parent functions for the children Columns.
@@ -22,12 +34,49 @@
  *          float_column->set(12.32);
  *      }
  * 
+ * STORAGE: Every Column stores its cells in fixed-size chunks of CHUNK_SIZE cells (a segmented
+ * array). Appending a row only ever allocates a new chunk when the last one is full, and only the
+ * small table of chunk pointers is grown (by doubling), so add_row() is amortized O(1) and cells
+ * that already exist are NEVER moved or copied. The cell at a row lives at
+ * chunk (row / CHUNK_SIZE), offset (row % CHUNK_SIZE), and the cells inside one chunk are
+ * contiguous in memory.
+ * 
+ * MAPPED: A Column opened from a file with DataFrame::open(...) does not copy its cells, its
+ * chunks point straight into a MappedFile (see datafile.h). A mapped chunk is copied onto the
+ * heap the first time any of its cells are changed, and is read-only until then. Because cells can
+ * be written through the pointer returned by get_chunk(...), it also copies a mapped chunk. Every
+ * read-only pass (scans, kernels, reductions, GroupBy, Row, sorting, save(...)) instead reads
+ * through get_chunk_const(...), which returns the mapped page itself, so reading a file never
+ * makes more of it resident than the pages that are touched. The same goes for the chunks shared
+ * with a Snapshot (see snapshot.h), which are only copied by get_chunk(...).
+ * 
+ * MISSING: A cell can be missing instead of holding a value (see is_missing(...)). Which cells
+ * are valid is kept in a validity bitmap of one bit per row, in chunks of VALIDITY_WORDS words
+ * lined up with the chunks of cells. A Column with no missing cells has no validity chunks at
+ * all, and neither does any chunk whose cells are all valid, so dense Columns pay nothing. A
+ * missing cell still holds the default value of its Column, which is what get_*(...) returns
+ * for it. Setting a cell (with set(...), put(...), append(...), ...) makes it valid again.
+ * Scans AND their matches with the validity words of each chunk, so a missing cell never
+ * matches a query, and reductions skip missing cells the same way.
+ * 
  * Authors: 
  *      csstransky - stransky.c@husky.neu.edu
  *      kaylindevchand - devchand.k@husky.neu.edu
  */
 class Column : public Object {
     public:
+    /**
+     * The number of cells held by each chunk of a Column. Every chunk except the last is always
+     * full.
+     */
+    static const size_t CHUNK_SIZE = 4096;
+
+    /* A row passed to gather(...) that gives a missing cell instead of copying a cell */
+    static const size_t GATHER_DEFAULT = (size_t)-1;
+
+    /* The number of 64-bit words of each chunk of the validity bitmap */
+    static const size_t VALIDITY_WORDS = CHUNK_SIZE / 64;
+
     /**
      * Returns the total number of elements inside the Column.
      * 
@@ -169,19 +218,19 @@ class Column : public Object {
     /**
      * Adds a row to the Column with a default value in the cell.
      * 
+     * NOTE: This is amortized O(1), a new chunk is only allocated once every CHUNK_SIZE rows.
+     * 
      * CAUTION: This function should be used with great care when a Column is linked to a dataframe. 
      * Because a dataframe MUST have the same number of rows for EACH Column, make sure that this 
      * function applies to ALL Columns inside the dataframe.
      */
-    virtual void add_row(); 
-    // This being virtual or not is determined by how the arrays that store the data will be
-    // implemented. This may not be virtual and instead be added separately to each Column instead.
-    // Open an issue or pull request based off your implementation. 
+    virtual void add_row();
 
     /**
      * Adds a row to the Column at a specified row with a default value in the cell.
      * 
      * NOTE: If the row index is out of bounds, then an "error" will be thrown.
+     * NOTE: Every cell after the row index is shifted down by one, so this is O(n - row).
      * 
      * CAUTION: This function should be used with great care when a Column is linked to a dataframe. 
      * Because a dataframe MUST have the same number of rows for EACH Column, make sure that this 
@@ -189,15 +238,14 @@ class Column : public Object {
      * 
      * @param row - The numbered row of the dataframe (starting from 0)
      */
-    virtual void add_row(size_t row); 
-    // This being virtual or not is determined by how the arrays that store the data will be
-    // implemented. This may not be virtual and instead be added separately to each Column instead.
-    // Open an issue or pull request based off your implementation. 
+    virtual void add_row(size_t row);
 
     /**
      * Removes a row from the Column at a specified row index.
      * 
      * NOTE: If the row index is out of bounds, then an "error" will be thrown.
+     * NOTE: Every cell after the row index is shifted up by one, so this is O(n - row). A chunk
+     * left empty at the end of the Column is freed.
      * 
      * CAUTION: This function should be used with great care when a Column is linked to a dataframe. 
      * Because a dataframe MUST have the same number of rows for EACH Column, make sure that this 
@@ -206,15 +254,251 @@ class Column : public Object {
      * @param row - The numbered row of the dataframe (starting from 0)
      */
     virtual void remove_row(size_t row);
-    // This being virtual or not is determined by how the arrays that store the data will be
-    // implemented. This may not be virtual and instead be added separately to each Column instead.
-    // Open an issue or pull request based off your implementation. 
+
+    /**
+     * Adds many rows to the end of the Column, each with a default value in the cell. Whole
+     * chunks are allocated at once instead of one row at a time.
+     * 
+     * CAUTION: This function should be used with great care when a Column is linked to a dataframe. 
+     * Because a dataframe MUST have the same number of rows for EACH Column, make sure that this 
+     * function applies to ALL Columns inside the dataframe.
+     * 
+     * @param num_rows - The number of rows to be added
+     */
+    void add_rows(size_t num_rows);
+
+    /**
+     * Creates a new Column of the same type and header, with the cells of the specified rows in
+     * the given order. The cells are copied in one pass, reading a chunk at a time where the rows
+     * allow it, so this is how operations such as joins build their results in bulk.
+     * 
+     * NOTE: If a row is out of bounds, then an "error" will be thrown. A row of GATHER_DEFAULT
+     * gives a missing cell instead (see is_missing(...)), and missing cells stay missing.
+     * 
+     * @param rows - The numbered rows of the Column (starting at 0) to be copied
+     * @param num_rows - The number of rows inside of rows
+     * @return A new Column with num_rows cells, so care should be taken to delete it
+     */
+    virtual Column* gather(size_t* rows, size_t num_rows);
+
+    /**
+     * Rearranges the cells of the Column in place, so that row r afterwards holds the cell that
+     * was at rows[r]. The cells are gathered into new chunks (as with gather(...)) which then
+     * replace the chunks of the Column, so the Column itself, its header, Arena, ThreadPool and
+     * any pointers to it stay valid. The old chunks are freed (or recycled to the Arena, or left
+     * to the file if they are mapped), and any ColumnIndex is invalidated.
+     * 
+     * NOTE: If rows does not hold size() rows, each in bounds, then an "error" will be thrown.
+     * 
+     * @param rows - A permutation of the numbered rows of the Column (starting at 0), with
+     * size() rows
+     */
+    virtual void permute(size_t* rows);
+
+    /**
+     * Adds many rows to the Column at once, each with a default value in the cell. The cells are
+     * shifted in a single pass from the end of the Column, so each cell is moved at most once.
+     * 
+     * NOTE: If any row is out of bounds, then an "error" will be thrown.
+     * 
+     * CAUTION: This function should be used with great care when a Column is linked to a dataframe. 
+     * Because a dataframe MUST have the same number of rows for EACH Column, make sure that this 
+     * function applies to ALL Columns inside the dataframe.
+     * 
+     * @param rows - The numbered rows of the Column (starting from 0) that a default cell will be
+     * added before, in increasing order. The same row may be given more than once.
+     * @param num_rows - The number of rows inside of rows
+     */
+    virtual void add_rows(size_t* rows, size_t num_rows);
+
+    /**
+     * Removes every row selected by a Bitmap from the Column at once. The remaining cells are
+     * moved in a single pass, so each cell is moved at most once.
+     * 
+     * NOTE: If the Bitmap is not the same size as the Column, then an "error" will be thrown.
+     * 
+     * CAUTION: This function should be used with great care when a Column is linked to a dataframe. 
+     * Because a dataframe MUST have the same number of rows for EACH Column, make sure that this 
+     * function applies to ALL Columns inside the dataframe.
+     * 
+     * @param rows - The Bitmap with bit r set for every row r to be removed
+     */
+    virtual void remove_rows(Bitmap* rows);
+
+    /**
+     * Sets the Arena that every chunk (of cells or of validity words) allocated from now on is
+     * carved out of, instead of the heap. A Column created by a DataFrame (such as by query(...))
+     * uses the DataFrame's Arena. A chunk the Column replaces or frees (when it is copied on
+     * write, compacted, or left empty) is given back with Arena::recycle(...).
+     * 
+     * CAUTION: The Arena MUST outlive the Column. The Column itself, its chunk table, zone maps,
+     * StringDictionary and CompressedChunks still live on the heap, so it must still be deleted.
+     * 
+     * @param arena - The Arena to allocate chunks from, or nullptr to use the heap
+     */
+    void set_arena(Arena* arena);
+
+    /**
+     * Sets the ThreadPool that the arithmetic and reductions of the Column (such as
+     * IntColumn::apply(...) or FloatColumn::sum()) split their chunks across. Columns of a
+     * DataFrame are given the DataFrame's ThreadPool (see DataFrame::set_thread_pool(...)).
+     * 
+     * NOTE: The Column does not take ownership of the ThreadPool.
+     * 
+     * @param pool - The ThreadPool to run on, or nullptr to run on the calling thread
+     */
+    void set_thread_pool(ThreadPool* pool);
+
+    /**
+     * Sets the Stats that the operations of the Column are counted into, when DATAFRAME_PROFILE
+     * is defined (see stats.h). Columns of a DataFrame are given the DataFrame's Stats.
+     * 
+     * NOTE: The Column does not take ownership of the Stats.
+     * 
+     * @param stats - The Stats to count into, or nullptr to count nothing
+     */
+    void set_stats(Stats* stats);
+
+    /**
+     * Sets the ColumnIndex that the Column keeps up to date as its cells change. Every cell added
+     * to the end of the Column (by add_row(), add_rows(...) or append(...)) is given to
+     * ColumnIndex::append(...), so the index stays usable across appends. Any other change (such
+     * as set(...), remove_row(...), or a row added in the middle) calls ColumnIndex::invalidate().
+     * DataFrame::create_index(...) and DataFrame::drop_index(...) call this.
+     * 
+     * NOTE: The Column does not take ownership of the ColumnIndex.
+     * 
+     * @param index - The ColumnIndex built on this Column, or nullptr to keep none
+     */
+    void set_index(ColumnIndex* index);
+
+    /**
+     * Returns the number of chunks currently allocated to hold the cells of the Column.
+     * 
+     * @return The number of chunks, which is size() / CHUNK_SIZE rounded up
+     */
+    size_t num_chunks();
+
+    /**
+     * Returns the number of cells stored in a specified chunk of the Column.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return CHUNK_SIZE for every chunk except the last, which may hold fewer cells
+     */
+    size_t chunk_length(size_t chunk);
+
+    /**
+     * Finds whether a cell of the Column is missing, by checking its bit of the validity bitmap.
+     * 
+     * NOTE: If the row index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param row - The numbered row of the Column (starting at 0)
+     * @return True if the cell has no value, false if it holds a value
+     */
+    bool is_missing(size_t row);
+
+    /**
+     * Marks a cell of the Column as missing, and puts the default value of the Column in it.
+     * 
+     * NOTE: If the row index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param row - The numbered row of the Column (starting at 0)
+     */
+    void set_missing(size_t row);
+
+    /**
+     * Adds many missing cells to the end of the Column at once. The validity bits of whole words
+     * are cleared at a time, so this is how a DataFrame pads a Column that is too short.
+     * 
+     * CAUTION: This function should be used with great care when a Column is linked to a dataframe. 
+     * Because a dataframe MUST have the same number of rows for EACH Column, make sure that this 
+     * function applies to ALL Columns inside the dataframe.
+     * 
+     * @param num_rows - The number of missing cells to be added
+     */
+    void add_missing(size_t num_rows);
+
+    /**
+     * Returns the number of missing cells inside the Column.
+     * 
+     * @return The number of cells for which is_missing(...) is true
+     */
+    size_t num_missing();
+
+    /**
+     * Gets the validity words of a specified chunk of the Column, where bit (row % 64) of word
+     * ((row % CHUNK_SIZE) / 64) is set if the cell at that row holds a value. Only the bits of
+     * the first chunk_length(chunk) cells are used.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return The VALIDITY_WORDS words of the chunk, or nullptr if every cell of the chunk is
+     * valid
+     */
+    uint64_t* get_validity_chunk(size_t chunk);
+
+    protected:
+    /**
+     * Allocates one more chunk filled with the default value of the Column, and grows the table
+     * of chunk pointers (by doubling) if it is full. Existing chunks are never moved.
+     */
+    virtual void add_chunk_();
+
+    /* The header of the Column, nullptr if there is none */
+    String* header_;
+
+    /* The total number of cells inside the Column */
+    size_t size_;
+
+    /* The number of chunks that have been allocated */
+    size_t num_chunks_;
+
+    /* The number of chunk pointers the chunk table can hold before it must grow */
+    size_t chunk_capacity_;
+
+    /* The file that chunks may point into, nullptr if the Column is not mapped */
+    MappedFile* mapping_;
+
+    /* The ColumnIndex appended to or invalidated as cells change, nullptr if there is none */
+    ColumnIndex* index_;
+
+    /* The Arena that chunks are allocated from, nullptr to allocate them on the heap */
+    Arena* arena_;
+
+    /* The ThreadPool that arithmetic and reductions run on, nullptr for the calling thread */
+    ThreadPool* pool_;
+
+    /* The Stats that operations are counted into, nullptr to count nothing */
+    Stats* stats_;
+
+    /**
+     * The table of validity chunks, lined up with the chunks of cells. The table is nullptr until
+     * the first cell goes missing, and each entry is nullptr while every cell of its chunk is
+     * valid.
+     */
+    uint64_t** validity_;
+
+    /* The number of cells whose validity bit is 0 */
+    size_t num_missing_;
 };
 
 /**
  * A Column made entirely of integers.
  * 
- * NOTE: The default value for an "empty" integer is 0
+ * STORAGE: By default each chunk holds plain ints. compress() instead stores each full chunk as
+ * a CompressedChunk (see compression.h), run-length, delta or frame-of-reference encoded,
+ * whichever an analyzer finds smallest for that chunk. Compressed chunks are read in place:
+ * match(...) compares on the encoded form where it can, sum(), min() and max() reduce RLE and FOR
+ * chunks without decoding them (given the validity words of the chunk, so missing cells are
+ * skipped, see CompressedChunk::sum(...)), and every other read-only pass (GroupBy, sorting,
+ * save(...), ...) decodes a chunk at a time into scratch memory with get_chunk_const(...). Only a
+ * write (set(...), put(...), get_chunk(...), apply(...), ...) decompresses a chunk in place, and
+ * only the chunk that it touches. DataFrame::save(...) always writes plain ints.
+ * 
+ * NOTE: The default value for an "empty" integer is 0, which is also what a missing cell holds
  */
 class IntColumn : public Column {
     public:
@@ -236,6 +520,26 @@ class IntColumn : public Column {
      */
     IntColumn(String* header, int nums, ...);
 
+    /**
+     * Constructs an IntColumn whose cells are read straight from a block of a MappedFile, without
+     * copying them. Only the chunk table and zone maps are allocated, and the cells are read from
+     * disk the first time they are touched.
+     * 
+     * NOTE: If the block is not inside of the file, or not aligned to DATAFILE_ALIGNMENT, then an
+     * "error" will be thrown.
+     * 
+     * @param header - The header of the IntColumn, or nullptr
+     * @param file - The MappedFile, which is NOT owned by the IntColumn and must outlive it
+     * @param offset - The offset of the block inside of the file
+     * @param length - The number of cells inside of the block (each an int)
+     * @param validity_offset - The offset of the validity block inside of the file (see
+     * datafile.h), whose words are mapped the same way, or 0 if every cell holds a value
+     * @param zones_offset - The offset of the zone map block inside of the file (see datafile.h),
+     * copied into the zone map of each chunk, or 0 to build the zone maps by scanning every cell
+     */
+    IntColumn(String* header, MappedFile* file, size_t offset, size_t length,
+        size_t validity_offset, size_t zones_offset);
+
     /* Deconstructs the IntColumn */
     ~IntColumn();
 
@@ -244,7 +548,8 @@ class IntColumn : public Column {
      * 
      * @param obj - The Object that will be compared 
      * @return For an IntColumn to equal another IntColumn, all of their elements must be the same,
-     * and the order of those elements must also be the same.
+     * and the order of those elements must also be the same. A missing cell only equals a
+     * missing cell, never a real value (not even the default value).
      */
     bool equals(Object* const obj);
 
@@ -256,6 +561,52 @@ class IntColumn : public Column {
      */
     int get_int(size_t row);
 
+    /**
+     * Gets an int from the IntColumn at a specified row, without a virtual call.
+     * 
+     * NOTE: Unlike get_int(...), this is NOT virtual and is defined inline right here, so the
+     * compiler can inline it into a tight loop. It only checks the row with an assert, which is
+     * gone once built with NDEBUG. Use DataFrame::as_int_column(...) to get a typed IntColumn*
+     * from a DataFrame. A compressed chunk is read with CompressedChunk::get(...).
+     * 
+     * @param row - The numbered row of the Column (starting at 0)
+     * @return The int inside of the cell at the specified row
+     */
+    int get(size_t row) {
+        DF_PROFILE_SCOPE(this->stats_, OP_COLUMN_GET, 1);
+        assert(row < this->size_);
+        size_t chunk = row / CHUNK_SIZE;
+        if (this->compressed_ != nullptr && this->compressed_[chunk] != nullptr) {
+            return this->compressed_[chunk]->get(row % CHUNK_SIZE);
+        }
+        return this->chunks_[chunk][row % CHUNK_SIZE];
+    }
+
+    /**
+     * Sets the int value inside of the IntColumn at a specified row, without a virtual call.
+     * 
+     * NOTE: Unlike set(...), this is NOT virtual and is defined inline right here, and only
+     * checks the row with an assert. The cell is written through get_chunk(...), so a mapped,
+     * shared or compressed chunk is copied or decompressed first, and the zone map of the chunk
+     * is widened to hold the int. A Column with missing cells or a ColumnIndex instead takes
+     * put_slow_(...), which also makes the cell valid and updates the ColumnIndex.
+     * 
+     * @param row - The numbered row of the Column (starting at 0)
+     * @param int_value - The int value to be added to the cell of the Column
+     */
+    void put(size_t row, int int_value) {
+        DF_PROFILE_SCOPE(this->stats_, OP_COLUMN_SET, 1);
+        assert(row < this->size_);
+        if (this->validity_ != nullptr || this->index_ != nullptr) {
+            this->put_slow_(row, int_value);
+            return;
+        }
+        size_t chunk = row / CHUNK_SIZE;
+        this->get_chunk(chunk)[row % CHUNK_SIZE] = int_value;
+        if (int_value < this->chunk_mins_[chunk]) this->chunk_mins_[chunk] = int_value;
+        if (int_value > this->chunk_maxs_[chunk]) this->chunk_maxs_[chunk] = int_value;
+    }
+
     /**
      * Sets the int value inside of the IntColumn at a specified row.
      * 
@@ -270,12 +621,286 @@ class IntColumn : public Column {
      * @return True if the Column class is an IntColumn, false otherwise.
      */
     bool is_int_column();
+
+    /**
+     * Finds every row of the IntColumn whose cell is equal to int_value.
+     * Each chunk is compared with scan_equal(...), which is SIMD-vectorized where supported. Any
+     * chunk whose zone map (see chunk_min(...)) cannot hold int_value is skipped. A compressed
+     * chunk is compared with CompressedChunk::match(...), without decompressing it.
+     * 
+     * @param int_value - The int that every cell will be compared to
+     * @return A new Bitmap of size() bits, where bit r is set if row r matched
+     */
+    Bitmap* match(int int_value);
+
+    /**
+     * Gets the smallest int of a chunk, from the zone map kept for each chunk. The zone map is
+     * widened as cells are set or added, but never shrunk until the chunk is rewritten (such as
+     * by remove_row(...)), so it may be looser than the real smallest int, but never tighter.
+     * Scans use it to skip chunks that cannot hold a value.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A value no larger than any int inside of the chunk
+     */
+    int chunk_min(size_t chunk);
+
+    /**
+     * Gets the largest int of a chunk, from the zone map kept for each chunk (see
+     * chunk_min(...)).
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A value no smaller than any int inside of the chunk
+     */
+    int chunk_max(size_t chunk);
+
+    /**
+     * Applies arithmetic with the same int to every cell of the IntColumn, in place. Each chunk is
+     * changed with apply_kernel(...) (see kernels.h), which is SIMD-vectorized where supported.
+     * 
+     * NOTE: If op is DIV_ARITH and int_value is 0, then an "error" will be thrown. DIV_ARITH
+     * rounds toward 0. ADD_ARITH, SUB_ARITH and MUL_ARITH wrap around on overflow, and INT_MIN
+     * DIV_ARITH -1 is INT_MIN (see ArithOp).
+     * 
+     * NOTE: Missing cells are left missing, still holding the default value.
+     * 
+     * @param op - The arithmetic that is applied, as in (cell op int_value)
+     * @param int_value - The int that every cell is combined with
+     */
+    void apply(ArithOp op, int int_value);
+
+    /**
+     * Applies arithmetic between each cell of the IntColumn and the cell at the same row of
+     * another IntColumn, in place.
+     * 
+     * NOTE: If the two Columns are not the same size, or if op is DIV_ARITH and any valid cell of
+     * other is 0, then an "error" will be thrown. ADD_ARITH, SUB_ARITH and MUL_ARITH wrap around
+     * on overflow, and INT_MIN DIV_ARITH -1 is INT_MIN (see ArithOp).
+     * 
+     * NOTE: A cell is only changed if both it and the cell of other hold a value. If the cell
+     * of other is missing, the cell becomes missing (and holds the default value).
+     * 
+     * @param op - The arithmetic that is applied, as in (cell op other cell)
+     * @param other - The IntColumn to combine with, which is not changed
+     */
+    void apply(ArithOp op, IntColumn* other);
+
+    /**
+     * Creates a new IntColumn holding arithmetic with the same int applied to every cell,
+     * leaving this IntColumn unchanged.
+     * 
+     * NOTE: If op is DIV_ARITH and int_value is 0, then an "error" will be thrown. DIV_ARITH
+     * rounds toward 0. ADD_ARITH, SUB_ARITH and MUL_ARITH wrap around on overflow, and INT_MIN
+     * DIV_ARITH -1 is INT_MIN (see ArithOp).
+     * 
+     * NOTE: Missing cells stay missing in the new IntColumn.
+     * 
+     * @param op - The arithmetic that is applied, as in (cell op int_value)
+     * @param int_value - The int that every cell is combined with
+     * @return A new IntColumn with no header, so care should be taken to delete it
+     */
+    IntColumn* map(ArithOp op, int int_value);
+
+    /**
+     * Creates a new IntColumn holding arithmetic between each cell of this IntColumn and the
+     * cell at the same row of another IntColumn, leaving both unchanged.
+     * 
+     * NOTE: If the two Columns are not the same size, or if op is DIV_ARITH and any valid cell of
+     * other is 0, then an "error" will be thrown. ADD_ARITH, SUB_ARITH and MUL_ARITH wrap around
+     * on overflow, and INT_MIN DIV_ARITH -1 is INT_MIN (see ArithOp).
+     * 
+     * NOTE: A cell of the new IntColumn is missing if either of the cells it is made from is
+     * missing.
+     * 
+     * @param op - The arithmetic that is applied, as in (cell op other cell)
+     * @param other - The IntColumn to combine with
+     * @return A new IntColumn with no header, so care should be taken to delete it
+     */
+    IntColumn* map(ArithOp op, IntColumn* other);
+
+    /**
+     * Creates a new FloatColumn holding every cell of the IntColumn converted to a float (see
+     * cast_kernel(...) in kernels.h).
+     * 
+     * NOTE: Missing cells stay missing in the new FloatColumn.
+     * 
+     * @return A new FloatColumn with the same header, so care should be taken to delete it
+     */
+    FloatColumn* to_float();
+
+    /**
+     * Sums every valid cell of the IntColumn into a 64-bit integer, so the sum can never overflow.
+     * 
+     * @return The sum of every cell, 0 if the IntColumn is empty
+     */
+    int64_t sum();
+
+    /**
+     * Finds the smallest valid cell of the IntColumn.
+     * 
+     * NOTE: If the IntColumn has no valid cells, then an "error" will be thrown.
+     * 
+     * @return The smallest int
+     */
+    int min();
+
+    /**
+     * Finds the largest valid cell of the IntColumn.
+     * 
+     * NOTE: If the IntColumn has no valid cells, then an "error" will be thrown.
+     * 
+     * @return The largest int
+     */
+    int max();
+
+    /**
+     * Finds the mean of every valid cell of the IntColumn.
+     * 
+     * NOTE: If the IntColumn has no valid cells, then an "error" will be thrown.
+     * 
+     * @return The sum of every valid cell divided by the number of valid cells
+     */
+    double mean();
+
+    /**
+     * Finds the (population) variance of every valid cell of the IntColumn. Each chunk is reduced
+     * to its count, mean and M2 with moments_kernel(...) (see kernels.h), and the chunks are
+     * combined with merge_moments(...), so the chunks can be reduced on any thread and no
+     * precision is lost when the mean is large next to the spread of the cells.
+     * 
+     * NOTE: If the IntColumn has no valid cells, then an "error" will be thrown.
+     * 
+     * @return The mean of the squared distance of each cell from mean()
+     */
+    double variance();
+
+    /**
+     * Gets the contiguous cells of a specified chunk of the IntColumn, allowing a whole chunk to
+     * be changed in one tight loop. Only the first chunk_length(chunk) cells are valid. A mapped
+     * or shared chunk is copied first, so use get_chunk_const(...) to only read it.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown. A compressed
+     * chunk is decompressed in place for good, since the returned cells may be changed.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A pointer to the first int of the chunk
+     */
+    int* get_chunk(size_t chunk);
+
+    /**
+     * Gets the contiguous cells of a specified chunk for reading only. Unlike get_chunk(...), a
+     * mapped or shared chunk is returned as it is, without copying it, and a compressed chunk
+     * stays compressed: it is decoded with CompressedChunk::decode(...) into a scratch chunk of
+     * CHUNK_SIZE ints owned by the calling thread.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * CAUTION: The cells of a compressed chunk are only valid until the next get_chunk_const(...)
+     * of a compressed chunk on the same thread. Use get_chunk_const(chunk, scratch) to keep them.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A pointer to the first int of the chunk, which must NOT be written through
+     */
+    const int* get_chunk_const(size_t chunk);
+
+    /**
+     * Gets the contiguous cells of a specified chunk for reading only, decoding a compressed chunk
+     * into memory given by the caller instead of the thread's scratch chunk.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @param scratch - Where a compressed chunk is decoded, which must hold CHUNK_SIZE ints. It is
+     * not used if the chunk is plain.
+     * @return A pointer to the first int of the chunk (scratch if the chunk is compressed), which
+     * must NOT be written through
+     */
+    const int* get_chunk_const(size_t chunk, int* scratch);
+
+    /**
+     * Adds many ints to the end of the IntColumn at once. The values are copied a chunk at a
+     * time with memcpy(...).
+     * 
+     * CAUTION: This function should be used with great care when a Column is linked to a dataframe. 
+     * Because a dataframe MUST have the same number of rows for EACH Column, make sure that this 
+     * function applies to ALL Columns inside the dataframe.
+     * 
+     * @param values - The first of the ints to be added
+     * @param num_values - The number of ints inside of values
+     */
+    void append(const int* values, size_t num_values);
+
+    /**
+     * Sets many cells of the IntColumn at once, starting at a specified row. The values are
+     * copied a chunk at a time with memcpy(...).
+     * 
+     * NOTE: If start + num_values is past size(), then an "error" will be thrown.
+     * 
+     * @param start - The numbered row of the first cell to be set (starting at 0)
+     * @param values - The first of the ints to be set
+     * @param num_values - The number of ints inside of values
+     */
+    void set_range(size_t start, const int* values, size_t num_values);
+
+    /**
+     * Compresses every full chunk of the IntColumn. Each chunk is given to
+     * CompressedChunk::analyze(...), and stored as a CompressedChunk unless no encoding is smaller
+     * than its plain ints. The last chunk is left plain while it still has room for more rows.
+     * 
+     * NOTE: Chunks that are already compressed are left as they are, so this can be called again
+     * after rows are added to compress the new chunks.
+     */
+    void compress();
+
+    /**
+     * Gets how a specified chunk of the IntColumn is stored.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return The IntEncoding of the chunk, PLAIN_ENCODING if it is not compressed
+     */
+    IntEncoding chunk_encoding(size_t chunk);
+
+    /**
+     * Gets the number of bytes used by the cells of the IntColumn, counting CHUNK_SIZE ints for
+     * each plain chunk and CompressedChunk::memory_size() for each compressed chunk.
+     * 
+     * @return The bytes of every chunk of the IntColumn
+     */
+    size_t memory_size();
+
+    protected:
+    /* Loader appends parsed chunks straight into the chunk table */
+    friend class Loader;
+
+    /* Inherited from Column, allocates a chunk of ints */
+    void add_chunk_();
+
+    /* put(...) for a Column with missing cells or a ColumnIndex, the same as set(...) */
+    void put_slow_(size_t row, int int_value);
+
+    /* The table of chunks, each holding CHUNK_SIZE ints, or nullptr if the chunk is compressed */
+    int** chunks_;
+
+    /**
+     * The compressed form of each chunk, or nullptr if the chunk is plain. The table itself is
+     * nullptr until compress() is first called.
+     */
+    CompressedChunk** compressed_;
+
+    /* The zone map of each chunk, its smallest and largest int */
+    int* chunk_mins_;
+    int* chunk_maxs_;
 };
 
 /**
  * A Column made entirely of floats.
  * 
- * NOTE: The default value for an "empty" float is 0.0
+ * NOTE: The default value for an "empty" float is 0.0, which is also what a missing cell holds
  */
 class FloatColumn : public Column {
     public:
@@ -297,6 +922,26 @@ class FloatColumn : public Column {
      */
     FloatColumn(String* header, float nums, ...);
 
+    /**
+     * Constructs a FloatColumn whose cells are read straight from a block of a MappedFile, without
+     * copying them. Only the chunk table and zone maps are allocated, and the cells are read from
+     * disk the first time they are touched.
+     * 
+     * NOTE: If the block is not inside of the file, or not aligned to DATAFILE_ALIGNMENT, then an
+     * "error" will be thrown.
+     * 
+     * @param header - The header of the FloatColumn, or nullptr
+     * @param file - The MappedFile, which is NOT owned by the FloatColumn and must outlive it
+     * @param offset - The offset of the block inside of the file
+     * @param length - The number of cells inside of the block (each a float)
+     * @param validity_offset - The offset of the validity block inside of the file (see
+     * datafile.h), whose words are mapped the same way, or 0 if every cell holds a value
+     * @param zones_offset - The offset of the zone map block inside of the file (see datafile.h),
+     * copied into the zone map of each chunk, or 0 to build the zone maps by scanning every cell
+     */
+    FloatColumn(String* header, MappedFile* file, size_t offset, size_t length,
+        size_t validity_offset, size_t zones_offset);
+
     /* Deconstructs the FloatColumn */
     ~FloatColumn();
 
@@ -305,7 +950,8 @@ class FloatColumn : public Column {
      * 
      * @param obj - The Object that will be compared 
      * @return For an FloatColumn to equal another FloatColumn, all of their elements must be the 
-     * same, and the order of those elements must also be the same.
+     * same, and the order of those elements must also be the same. A missing cell only equals a
+     * missing cell, never a real value (not even the default value).
      */
     bool equals(Object* const obj);
 
@@ -317,6 +963,48 @@ class FloatColumn : public Column {
      */
     float get_float(size_t row);
 
+    /**
+     * Gets a float from the FloatColumn at a specified row, without a virtual call.
+     * 
+     * NOTE: Unlike get_float(...), this is NOT virtual and is defined inline right here, so the
+     * compiler can inline it into a tight loop. It only checks the row with an assert, which is
+     * gone once built with NDEBUG. Use DataFrame::as_float_column(...) to get a typed
+     * FloatColumn* from a DataFrame.
+     * 
+     * @param row - The numbered row of the Column (starting at 0)
+     * @return The float inside of the cell at the specified row
+     */
+    float get(size_t row) {
+        DF_PROFILE_SCOPE(this->stats_, OP_COLUMN_GET, 1);
+        assert(row < this->size_);
+        return this->chunks_[row / CHUNK_SIZE][row % CHUNK_SIZE];
+    }
+
+    /**
+     * Sets the float value inside of the FloatColumn at a specified row, without a virtual call.
+     * 
+     * NOTE: Unlike set(...), this is NOT virtual and is defined inline right here, and only
+     * checks the row with an assert. The cell is written through get_chunk(...), so a mapped or
+     * shared chunk is copied first, and the zone map of the chunk is widened to hold the float
+     * (unless it is NaN). A Column with missing cells or a ColumnIndex instead takes
+     * put_slow_(...), which also makes the cell valid and updates the ColumnIndex.
+     * 
+     * @param row - The numbered row of the Column (starting at 0)
+     * @param float_value - The float value to be added to the cell of the Column
+     */
+    void put(size_t row, float float_value) {
+        DF_PROFILE_SCOPE(this->stats_, OP_COLUMN_SET, 1);
+        assert(row < this->size_);
+        if (this->validity_ != nullptr || this->index_ != nullptr) {
+            this->put_slow_(row, float_value);
+            return;
+        }
+        size_t chunk = row / CHUNK_SIZE;
+        this->get_chunk(chunk)[row % CHUNK_SIZE] = float_value;
+        if (float_value < this->chunk_mins_[chunk]) this->chunk_mins_[chunk] = float_value;
+        if (float_value > this->chunk_maxs_[chunk]) this->chunk_maxs_[chunk] = float_value;
+    }
+
     /**
      * Sets the float value inside of the FloatColumn at a specified row.
      * 
@@ -331,15 +1019,233 @@ class FloatColumn : public Column {
      * @return True if the Column class is an FloatColumn, false otherwise.
      */
     bool is_float_column();
+
+    /**
+     * Finds every row of the FloatColumn whose cell is equal to float_value.
+     * Each chunk is compared with scan_equal(...), which is SIMD-vectorized where supported. Any
+     * chunk whose zone map (see chunk_min(...)) cannot hold float_value is skipped.
+     * 
+     * @param float_value - The float that every cell will be compared to
+     * @return A new Bitmap of size() bits, where bit r is set if row r matched
+     */
+    Bitmap* match(float float_value);
+
+    /**
+     * Gets the smallest float of a chunk, from the zone map kept for each chunk. The zone map is
+     * widened as cells are set or added, but never shrunk until the chunk is rewritten (such as
+     * by remove_row(...)), so it may be looser than the real smallest float, but never tighter.
+     * Scans use it to skip chunks that cannot hold a value.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A value no larger than any float inside of the chunk
+     */
+    float chunk_min(size_t chunk);
+
+    /**
+     * Gets the largest float of a chunk, from the zone map kept for each chunk (see
+     * chunk_min(...)).
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A value no smaller than any float inside of the chunk
+     */
+    float chunk_max(size_t chunk);
+
+    /**
+     * Applies arithmetic with the same float to every cell of the FloatColumn, in place. Each
+     * chunk is changed with apply_kernel(...) (see kernels.h), which is SIMD-vectorized where
+     * supported.
+     * 
+     * NOTE: Missing cells are left missing, still holding the default value.
+     * 
+     * @param op - The arithmetic that is applied, as in (cell op float_value)
+     * @param float_value - The float that every cell is combined with
+     */
+    void apply(ArithOp op, float float_value);
+
+    /**
+     * Applies arithmetic between each cell of the FloatColumn and the cell at the same row of
+     * another FloatColumn, in place.
+     * 
+     * NOTE: If the two Columns are not the same size, then an "error" will be thrown.
+     * 
+     * NOTE: A cell is only changed if both it and the cell of other hold a value. If the cell
+     * of other is missing, the cell becomes missing (and holds the default value).
+     * 
+     * @param op - The arithmetic that is applied, as in (cell op other cell)
+     * @param other - The FloatColumn to combine with, which is not changed
+     */
+    void apply(ArithOp op, FloatColumn* other);
+
+    /**
+     * Creates a new FloatColumn holding arithmetic with the same float applied to every cell,
+     * leaving this FloatColumn unchanged.
+     * 
+     * NOTE: Missing cells stay missing in the new FloatColumn.
+     * 
+     * @param op - The arithmetic that is applied, as in (cell op float_value)
+     * @param float_value - The float that every cell is combined with
+     * @return A new FloatColumn with no header, so care should be taken to delete it
+     */
+    FloatColumn* map(ArithOp op, float float_value);
+
+    /**
+     * Creates a new FloatColumn holding arithmetic between each cell of this FloatColumn and the
+     * cell at the same row of another FloatColumn, leaving both unchanged.
+     * 
+     * NOTE: If the two Columns are not the same size, then an "error" will be thrown.
+     * 
+     * NOTE: A cell of the new FloatColumn is missing if either of the cells it is made from is
+     * missing.
+     * 
+     * @param op - The arithmetic that is applied, as in (cell op other cell)
+     * @param other - The FloatColumn to combine with
+     * @return A new FloatColumn with no header, so care should be taken to delete it
+     */
+    FloatColumn* map(ArithOp op, FloatColumn* other);
+
+    /**
+     * Creates a new IntColumn holding every cell of the FloatColumn converted to an int, rounding
+     * toward 0 and saturating at INT_MIN and INT_MAX (see cast_kernel(...) in kernels.h).
+     * 
+     * NOTE: Missing cells stay missing in the new IntColumn, and a NaN cell becomes a missing
+     * cell, as no int stands for it.
+     * 
+     * @return A new IntColumn with the same header, so care should be taken to delete it
+     */
+    IntColumn* to_int();
+
+    /**
+     * Sums every valid cell of the FloatColumn into a double.
+     * 
+     * @return The sum of every cell, 0 if the FloatColumn is empty
+     */
+    double sum();
+
+    /**
+     * Finds the smallest valid cell of the FloatColumn, skipping any NaN cells.
+     * 
+     * NOTE: If the FloatColumn has no valid cells, then an "error" will be thrown.
+     * 
+     * @return The smallest float
+     */
+    float min();
+
+    /**
+     * Finds the largest valid cell of the FloatColumn, skipping any NaN cells.
+     * 
+     * NOTE: If the FloatColumn has no valid cells, then an "error" will be thrown.
+     * 
+     * @return The largest float
+     */
+    float max();
+
+    /**
+     * Finds the mean of every valid cell of the FloatColumn.
+     * 
+     * NOTE: If the FloatColumn has no valid cells, then an "error" will be thrown.
+     * 
+     * @return The sum of every valid cell divided by the number of valid cells
+     */
+    double mean();
+
+    /**
+     * Finds the (population) variance of every valid cell of the FloatColumn. Each chunk is
+     * reduced to its count, mean and M2 with moments_kernel(...) (see kernels.h), and the chunks
+     * are combined with merge_moments(...), so the chunks can be reduced on any thread and no
+     * precision is lost when the mean is large next to the spread of the cells.
+     * 
+     * NOTE: If the FloatColumn has no valid cells, then an "error" will be thrown.
+     * 
+     * @return The mean of the squared distance of each cell from mean()
+     */
+    double variance();
+
+    /**
+     * Gets the contiguous cells of a specified chunk of the FloatColumn, allowing a whole chunk to
+     * be changed in one tight loop. Only the first chunk_length(chunk) cells are valid. A mapped
+     * or shared chunk is copied first, so use get_chunk_const(...) to only read it.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A pointer to the first float of the chunk
+     */
+    float* get_chunk(size_t chunk);
+
+    /**
+     * Gets the contiguous cells of a specified chunk for reading only. Unlike get_chunk(...), a
+     * mapped or shared chunk is returned as it is, without copying it.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A pointer to the first float of the chunk, which must NOT be written through
+     */
+    const float* get_chunk_const(size_t chunk);
+
+    /**
+     * Adds many floats to the end of the FloatColumn at once. The values are copied a chunk at a
+     * time with memcpy(...).
+     * 
+     * CAUTION: This function should be used with great care when a Column is linked to a dataframe. 
+     * Because a dataframe MUST have the same number of rows for EACH Column, make sure that this 
+     * function applies to ALL Columns inside the dataframe.
+     * 
+     * @param values - The first of the floats to be added
+     * @param num_values - The number of floats inside of values
+     */
+    void append(const float* values, size_t num_values);
+
+    /**
+     * Sets many cells of the FloatColumn at once, starting at a specified row. The values are
+     * copied a chunk at a time with memcpy(...).
+     * 
+     * NOTE: If start + num_values is past size(), then an "error" will be thrown.
+     * 
+     * @param start - The numbered row of the first cell to be set (starting at 0)
+     * @param values - The first of the floats to be set
+     * @param num_values - The number of floats inside of values
+     */
+    void set_range(size_t start, const float* values, size_t num_values);
+
+    protected:
+    /* Loader appends parsed chunks straight into the chunk table */
+    friend class Loader;
+
+    /* Inherited from Column, allocates a chunk of floats */
+    void add_chunk_();
+
+    /* put(...) for a Column with missing cells or a ColumnIndex, the same as set(...) */
+    void put_slow_(size_t row, float float_value);
+
+    /* The table of chunks, each holding CHUNK_SIZE floats */
+    float** chunks_;
+
+    /* The zone map of each chunk, its smallest and largest float (NaN cells are not counted) */
+    float* chunk_mins_;
+    float* chunk_maxs_;
 };
 
 /**
  * A Column made entirely of Booleans.
  * 
- * NOTE: The default value for an "empty" Boolean is false.
+ * STORAGE: Booleans are bit-packed into 64-bit words, 1 bit per cell, so a BoolColumn uses 8x
+ * less memory than one bool per cell. Row r is bit (r % 64) of word (r % CHUNK_SIZE) / 64 of
+ * chunk (r / CHUNK_SIZE). Any bits past the last row of the last word are always kept at 0, so
+ * whole words can be counted and masked without checking the Column length.
+ * 
+ * NOTE: The default value for an "empty" Boolean is false, which is also what a missing cell
+ * holds.
  */
 class BoolColumn : public Column {
     public:
+    /* The number of 64-bit words that make up one chunk of a BoolColumn */
+    static const size_t WORDS_PER_CHUNK = CHUNK_SIZE / 64;
+
     /* Constructs an empty BoolColumn with no header (nullptr) */
     BoolColumn();
 
@@ -358,6 +1264,24 @@ class BoolColumn : public Column {
      */
     BoolColumn(String* header, bool bools, ...);
 
+    /**
+     * Constructs a BoolColumn whose cells are read straight from a block of a MappedFile, without
+     * copying them. Only the chunk table is allocated, and the cells are read from disk the first
+     * time they are touched.
+     * 
+     * NOTE: If the block is not inside of the file, or not aligned to DATAFILE_ALIGNMENT, then an
+     * "error" will be thrown.
+     * 
+     * @param header - The header of the BoolColumn, or nullptr
+     * @param file - The MappedFile, which is NOT owned by the BoolColumn and must outlive it
+     * @param offset - The offset of the block inside of the file
+     * @param length - The number of cells inside of the block (each 1 bit of a packed word)
+     * @param validity_offset - The offset of the validity block inside of the file (see
+     * datafile.h), whose words are mapped the same way, or 0 if every cell holds a value
+     */
+    BoolColumn(String* header, MappedFile* file, size_t offset, size_t length,
+        size_t validity_offset);
+
     /* Deconstructs the BoolColumn */
     ~BoolColumn();
 
@@ -366,7 +1290,8 @@ class BoolColumn : public Column {
      * 
      * @param obj - The Object that will be compared 
      * @return For an BoolColumn to equal another BoolColumn, all of their elements must be the 
-     * same, and the order of those elements must also be the same.
+     * same, and the order of those elements must also be the same. A missing cell only equals a
+     * missing cell, never a real value (not even the default value).
      */
     bool equals(Object* const obj);
 
@@ -378,6 +1303,47 @@ class BoolColumn : public Column {
      */
     bool get_bool(size_t row);
 
+    /**
+     * Gets a Boolean from the BoolColumn at a specified row, without a virtual call.
+     * 
+     * NOTE: Unlike get_bool(...), this is NOT virtual and is defined inline right here, so the
+     * compiler can inline it into a tight loop. It only checks the row with an assert, which is
+     * gone once built with NDEBUG. Use DataFrame::as_bool_column(...) to get a typed BoolColumn*
+     * from a DataFrame.
+     * 
+     * @param row - The numbered row of the Column (starting at 0)
+     * @return The Boolean inside of the cell at the specified row
+     */
+    bool get(size_t row) {
+        DF_PROFILE_SCOPE(this->stats_, OP_COLUMN_GET, 1);
+        assert(row < this->size_);
+        uint64_t word = this->chunks_[row / CHUNK_SIZE][(row % CHUNK_SIZE) / 64];
+        return (word >> (row % 64)) & 1;
+    }
+
+    /**
+     * Sets the Boolean value inside of the BoolColumn at a specified row, without a virtual call.
+     * 
+     * NOTE: Unlike set(...), this is NOT virtual and is defined inline right here, and only
+     * checks the row with an assert. The bit is written through get_chunk(...), so a mapped or
+     * shared chunk is copied first. A Column with missing cells or a ColumnIndex instead takes
+     * put_slow_(...), which also makes the cell valid and updates the ColumnIndex.
+     * 
+     * @param row - The numbered row of the Column (starting at 0)
+     * @param bool_value - The Boolean value to be added to the cell of the Column
+     */
+    void put(size_t row, bool bool_value) {
+        DF_PROFILE_SCOPE(this->stats_, OP_COLUMN_SET, 1);
+        assert(row < this->size_);
+        if (this->validity_ != nullptr || this->index_ != nullptr) {
+            this->put_slow_(row, bool_value);
+            return;
+        }
+        uint64_t* word = &this->get_chunk(row / CHUNK_SIZE)[(row % CHUNK_SIZE) / 64];
+        uint64_t bit = (uint64_t)1 << (row % 64);
+        *word = bool_value ? (*word | bit) : (*word & ~bit);
+    }
+
     /**
      * Sets the Bool value inside of the BoolColumn at a specified row.
      * 
@@ -392,12 +1358,96 @@ class BoolColumn : public Column {
      * @return True if the Column class is an BoolColumn, false otherwise.
      */
     bool is_bool_column();
+
+    /**
+     * Finds every row of the BoolColumn whose cell is equal to bool_value.
+     * The packed words are copied (or inverted) straight into the Bitmap.
+     * 
+     * @param bool_value - The Boolean that every cell will be compared to
+     * @return A new Bitmap of size() bits, where bit r is set if row r matched
+     */
+    Bitmap* match(bool bool_value);
+
+    /**
+     * Counts the number of true cells inside of the BoolColumn. This is done a whole word at a
+     * time with a hardware popcount.
+     * 
+     * @return The number of cells that are true
+     */
+    size_t count_true();
+
+    /**
+     * Gets the packed words of a specified chunk of the BoolColumn, allowing a whole chunk to be
+     * read 64 cells at a time. Only the first (chunk_length(chunk) + 63) / 64 words are valid.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A pointer to the first of the WORDS_PER_CHUNK words of the chunk
+     */
+    uint64_t* get_chunk(size_t chunk);
+
+    /**
+     * Gets the packed words of a specified chunk for reading only. Unlike get_chunk(...), a
+     * mapped or shared chunk is returned as it is, without copying it.
+     * 
+     * NOTE: If the chunk index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A pointer to the first of the WORDS_PER_CHUNK words of the chunk, which must NOT be
+     * written through
+     */
+    const uint64_t* get_chunk_const(size_t chunk);
+
+    /**
+     * Adds many Booleans to the end of the BoolColumn at once. The values are copied a chunk at a
+     * time, packing 64 values into each word.
+     * 
+     * CAUTION: This function should be used with great care when a Column is linked to a dataframe. 
+     * Because a dataframe MUST have the same number of rows for EACH Column, make sure that this 
+     * function applies to ALL Columns inside the dataframe.
+     * 
+     * @param values - The first of the Booleans to be added
+     * @param num_values - The number of Booleans inside of values
+     */
+    void append(const bool* values, size_t num_values);
+
+    /**
+     * Sets many cells of the BoolColumn at once, starting at a specified row. The values are
+     * copied a chunk at a time, packing 64 values into each word.
+     * 
+     * NOTE: If start + num_values is past size(), then an "error" will be thrown.
+     * 
+     * @param start - The numbered row of the first cell to be set (starting at 0)
+     * @param values - The first of the Booleans to be set
+     * @param num_values - The number of Booleans inside of values
+     */
+    void set_range(size_t start, const bool* values, size_t num_values);
+
+    protected:
+    /* Loader appends parsed chunks straight into the chunk table */
+    friend class Loader;
+
+    /* Inherited from Column, allocates a zeroed chunk of WORDS_PER_CHUNK words */
+    void add_chunk_();
+
+    /* put(...) for a Column with missing cells or a ColumnIndex, the same as set(...) */
+    void put_slow_(size_t row, bool bool_value);
+
+    /* The table of chunks, each holding WORDS_PER_CHUNK words of packed Booleans */
+    uint64_t** chunks_;
 };
 
 /**
  * A Column made entirely of Strings.
  * 
- * NOTE: The default value for an "empty" String is ""
+ * STORAGE: By default each cell holds its own String*. A StringColumn can instead be
+ * dictionary-encoded with encode(), where every unique String is stored once in a
+ * StringDictionary (see dictionary.h) and each cell only holds the 32-bit code of its String.
+ * This is much smaller when the Column repeats a small number of distinct Strings, and lets
+ * match(...) compare integer codes instead of Strings.
+ * 
+ * NOTE: The default value for an "empty" String is "", which is also what a missing cell holds
  */
 class StringColumn : public Column {
     public:
@@ -426,6 +1476,25 @@ class StringColumn : public Column {
      */
     StringColumn(String* header, String* Strings, ...);
 
+    /**
+     * Constructs a dictionary-encoded StringColumn whose codes are read straight from a block of a
+     * MappedFile, without copying them. Only the chunk table is allocated, and the codes are read
+     * from disk the first time they are touched.
+     * 
+     * NOTE: If the block is not inside of the file, or not aligned to DATAFILE_ALIGNMENT, then an
+     * "error" will be thrown.
+     * 
+     * @param header - The header of the StringColumn, or nullptr
+     * @param file - The MappedFile, which is NOT owned by the StringColumn and must outlive it
+     * @param offset - The offset of the block of uint32_t codes inside of the file
+     * @param length - The number of codes inside of the block
+     * @param validity_offset - The offset of the validity block inside of the file (see
+     * datafile.h), whose words are mapped the same way, or 0 if every cell holds a value
+     * @param dictionary - The StringDictionary the codes refer to, owned by the StringColumn
+     */
+    StringColumn(String* header, MappedFile* file, size_t offset, size_t length,
+        size_t validity_offset, StringDictionary* dictionary);
+
     /* Deconstructs the StringColumn */
     ~StringColumn();
 
@@ -434,7 +1503,8 @@ class StringColumn : public Column {
      * 
      * @param obj - The Object that will be compared 
      * @return For an StringColumn to equal another StringColumn, all of their elements must be the
-     * same, and the order of those elements must also be the same.
+     * same, and the order of those elements must also be the same. A missing cell only equals a
+     * missing cell, never a real value (not even the default value).
      */
     bool equals(Object* const obj);
 
@@ -446,6 +1516,54 @@ class StringColumn : public Column {
      */
     String* get_string(size_t row);
 
+    /**
+     * Gets a String from the StringColumn at a specified row, without a virtual call.
+     * 
+     * NOTE: Unlike get_string(...), this is NOT virtual and is defined inline right here, so the
+     * compiler can inline it into a tight loop. It only checks the row with an assert, which is
+     * gone once built with NDEBUG. Use DataFrame::as_string_column(...) to get a typed
+     * StringColumn* from a DataFrame. An encoded cell is looked up in the StringDictionary.
+     * 
+     * @param row - The numbered row of the Column (starting at 0)
+     * @return The String inside of the cell at the specified row
+     */
+    String* get(size_t row) {
+        DF_PROFILE_SCOPE(this->stats_, OP_COLUMN_GET, 1);
+        assert(row < this->size_);
+        size_t chunk = row / CHUNK_SIZE;
+        if (this->dictionary_ != nullptr) {
+            return this->dictionary_->get(this->code_chunks_[chunk][row % CHUNK_SIZE]);
+        }
+        return this->chunks_[chunk][row % CHUNK_SIZE];
+    }
+
+    /**
+     * Sets the String value inside of the StringColumn at a specified row, without a virtual call.
+     * 
+     * NOTE: Unlike set(...), this is NOT virtual and is defined inline right here, and only
+     * checks the row with an assert. The cell is written through get_chunk(...), or through
+     * get_code_chunk(...) with the code from StringDictionary::intern(...) if encoded, so a
+     * mapped or shared chunk is copied first. A Column with missing cells or a ColumnIndex
+     * instead takes put_slow_(...), which also makes the cell valid and updates the ColumnIndex.
+     * 
+     * @param row - The numbered row of the Column (starting at 0)
+     * @param string_value - The String value to be added to the cell of the Column
+     */
+    void put(size_t row, String* string_value) {
+        DF_PROFILE_SCOPE(this->stats_, OP_COLUMN_SET, 1);
+        assert(row < this->size_);
+        if (this->validity_ != nullptr || this->index_ != nullptr) {
+            this->put_slow_(row, string_value);
+            return;
+        }
+        size_t chunk = row / CHUNK_SIZE;
+        if (this->dictionary_ != nullptr) {
+            this->get_code_chunk(chunk)[row % CHUNK_SIZE] = this->dictionary_->intern(string_value);
+        } else {
+            this->get_chunk(chunk)[row % CHUNK_SIZE] = string_value;
+        }
+    }
+
     /**
      * Sets the String value inside of the StringColumn at a specified row.
      * 
@@ -460,4 +1578,144 @@ class StringColumn : public Column {
      * @return True if the Column class is an StringColumn, false otherwise.
      */
     bool is_string_column();
+
+    /**
+     * Finds every row of the StringColumn whose cell is equal to string_value.
+     * Cells are compared with String::equals(...). If the StringColumn is dictionary-encoded,
+     * string_value is looked up in the dictionary once, and the codes of each chunk are then
+     * compared with scan_equal(...) instead.
+     * 
+     * @param string_value - The String that every cell will be compared to
+     * @return A new Bitmap of size() bits, where bit r is set if row r matched
+     */
+    Bitmap* match(String* string_value);
+
+    /**
+     * Gets the contiguous cells of a specified chunk of the StringColumn, allowing a whole chunk to
+     * be read in one tight loop. Only the first chunk_length(chunk) cells are valid.
+     * 
+     * NOTE: If the chunk index is out of bounds, or if the StringColumn is dictionary-encoded,
+     * then an "error" will be thrown. Use get_code_chunk(...) on an encoded StringColumn.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A pointer to the first String of the chunk
+     */
+    String** get_chunk(size_t chunk);
+
+    /**
+     * Gets the contiguous cells of a specified chunk for reading only. Unlike get_chunk(...), a
+     * mapped or shared chunk is returned as it is, without copying it.
+     * 
+     * NOTE: If the chunk index is out of bounds, or if the StringColumn is dictionary-encoded,
+     * then an "error" will be thrown. Use get_code_chunk_const(...) on an encoded StringColumn.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A pointer to the first String of the chunk, which must NOT be written through
+     */
+    String* const* get_chunk_const(size_t chunk);
+
+    /**
+     * Adds many Strings to the end of the StringColumn at once. The values are copied a chunk at
+     * a time, or interned a chunk at a time if the StringColumn is dictionary-encoded.
+     * 
+     * CAUTION: This function should be used with great care when a Column is linked to a dataframe. 
+     * Because a dataframe MUST have the same number of rows for EACH Column, make sure that this 
+     * function applies to ALL Columns inside the dataframe.
+     * 
+     * @param values - The first of the Strings to be added
+     * @param num_values - The number of Strings inside of values
+     */
+    void append(String* const* values, size_t num_values);
+
+    /**
+     * Sets many cells of the StringColumn at once, starting at a specified row. The values are
+     * copied a chunk at a time, or interned a chunk at a time if the StringColumn is
+     * dictionary-encoded.
+     * 
+     * NOTE: If start + num_values is past size(), then an "error" will be thrown.
+     * 
+     * @param start - The numbered row of the first cell to be set (starting at 0)
+     * @param values - The first of the Strings to be set
+     * @param num_values - The number of Strings inside of values
+     */
+    void set_range(size_t start, String* const* values, size_t num_values);
+
+    /**
+     * Converts the StringColumn to be dictionary-encoded. Every cell is replaced by the code of
+     * its String inside a new StringDictionary, which copies the characters of each String with
+     * StringDictionary::intern(...). The cell Strings are NOT deleted, they are still owned by
+     * whoever gave them to the StringColumn. Cells that are set or added afterwards are encoded
+     * as well. Calling this on an empty StringColumn makes it encoded from the start.
+     * 
+     * NOTE: Nothing happens if the StringColumn is already dictionary-encoded.
+     */
+    void encode();
+
+    /**
+     * Finds whether or not the StringColumn is dictionary-encoded.
+     * 
+     * @return True if encode() has been called, false otherwise.
+     */
+    bool is_encoded();
+
+    /**
+     * Gets the dictionary of the StringColumn.
+     * 
+     * @return The StringDictionary owned by the StringColumn, or nullptr if it is not encoded
+     */
+    StringDictionary* get_dictionary();
+
+    /**
+     * Gets the code of a cell of a dictionary-encoded StringColumn.
+     * 
+     * NOTE: If the row is out of bounds, or if the StringColumn is not dictionary-encoded,
+     * then an "error" will be thrown.
+     * 
+     * @param row - The numbered row of the Column (starting at 0)
+     * @return The code of the String inside of the cell at the specified row
+     */
+    uint32_t get_code(size_t row);
+
+    /**
+     * Gets the contiguous codes of a specified chunk of a dictionary-encoded StringColumn.
+     * Only the first chunk_length(chunk) codes are valid.
+     * 
+     * NOTE: If the chunk index is out of bounds, or if the StringColumn is not
+     * dictionary-encoded, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A pointer to the first code of the chunk
+     */
+    uint32_t* get_code_chunk(size_t chunk);
+
+    /**
+     * Gets the contiguous codes of a specified chunk for reading only. Unlike
+     * get_code_chunk(...), a mapped or shared chunk is returned as it is, without copying it.
+     * 
+     * NOTE: If the chunk index is out of bounds, or if the StringColumn is not
+     * dictionary-encoded, then an "error" will be thrown.
+     * 
+     * @param chunk - The numbered chunk of the Column (starting at 0)
+     * @return A pointer to the first code of the chunk, which must NOT be written through
+     */
+    const uint32_t* get_code_chunk_const(size_t chunk);
+
+    protected:
+    /* Loader appends parsed chunks straight into the chunk table */
+    friend class Loader;
+
+    /* Inherited from Column, allocates a chunk of Strings, or of codes if encoded */
+    void add_chunk_();
+
+    /* put(...) for a Column with missing cells or a ColumnIndex, the same as set(...) */
+    void put_slow_(size_t row, String* string_value);
+
+    /* The table of chunks, each holding CHUNK_SIZE Strings, nullptr if encoded */
+    String*** chunks_;
+
+    /* The dictionary of every unique String, nullptr if not encoded */
+    StringDictionary* dictionary_;
+
+    /* The table of chunks, each holding CHUNK_SIZE codes, nullptr if not encoded */
+    uint32_t** code_chunks_;
 };
\ No newline at end of file
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <stdint.h>
+#include "object.h"
+
+/**
+ * The ways a chunk of an IntColumn can be stored (see IntColumn::compress()).
+ * 
+ *      PLAIN_ENCODING  - Every int stored as is, 4 bytes per cell
+ *      RLE_ENCODING    - Runs of equal ints, stored as the value and the end row of each run
+ *      DELTA_ENCODING  - The difference of each int from the one before it, bit-packed, with the
+ *                        full int stored at the start of every DELTA_BLOCK cells
+ *      FOR_ENCODING    - Frame of reference, the difference of each int from the smallest int of
+ *                        the chunk, bit-packed into as few bits as the largest difference needs
+ */
+enum IntEncoding {
+    PLAIN_ENCODING,
+    RLE_ENCODING,
+    DELTA_ENCODING,
+    FOR_ENCODING
+};
+
+/**
+ * A read-only chunk of ints stored with one of the IntEncodings above. A CompressedChunk never
+ * changes once it is built, an IntColumn decompresses the chunk back to plain ints before any of
+ * its cells are changed. Reading never decompresses it: cells are read with get(...), whole
+ * chunks are decoded into separate memory with decode(...), and sum(), min_max(...) and
+ * match(...) work on the encoded form.
+ * 
+ * Reading a single cell with get(...) takes O(1) for FOR_ENCODING, O(log runs) for RLE_ENCODING
+ * and at most DELTA_BLOCK steps for DELTA_ENCODING. match(...) is evaluated on the encoded form
+ * without decompressing: a whole run at a time for RLE_ENCODING, and by comparing the packed
+ * differences for FOR_ENCODING (skipping the chunk outright if the int is outside of its range).
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class CompressedChunk : public Object {
+    public:
+    /* The number of cells between each full int stored by DELTA_ENCODING */
+    static const size_t DELTA_BLOCK = 64;
+
+    /**
+     * Constructs a CompressedChunk by encoding a run of ints.
+     * 
+     * NOTE: If encoding is PLAIN_ENCODING, or length is 0, then an "error" will be thrown.
+     * 
+     * @param values - The ints to be encoded, which are copied
+     * @param length - The number of ints inside of values
+     * @param encoding - The encoding to store the ints with, usually from analyze(...)
+     */
+    CompressedChunk(const int* values, size_t length, IntEncoding encoding);
+
+    /* Deconstructs the CompressedChunk */
+    ~CompressedChunk();
+
+    /**
+     * Picks the encoding that stores a run of ints in the fewest bytes, from a single pass that
+     * counts the runs and finds the range of the ints and of the differences between them.
+     * 
+     * @param values - The ints to be analyzed
+     * @param length - The number of ints inside of values
+     * @return The smallest encoding, or PLAIN_ENCODING if no encoding is smaller than the ints
+     */
+    static IntEncoding analyze(const int* values, size_t length);
+
+    /**
+     * Gets the encoding of the CompressedChunk.
+     * 
+     * @return The IntEncoding the ints are stored with
+     */
+    IntEncoding encoding();
+
+    /**
+     * Gets the number of ints inside of the CompressedChunk.
+     * 
+     * @return The length the CompressedChunk was constructed with
+     */
+    size_t length();
+
+    /**
+     * Gets the number of bytes used to store the ints, not counting the CompressedChunk itself.
+     * 
+     * @return The bytes of the runs, packed words and stored full ints
+     */
+    size_t memory_size();
+
+    /**
+     * Gets an int of the CompressedChunk, without decompressing the rest of it.
+     * 
+     * NOTE: If the index is out of bounds, then an "error" will be thrown.
+     * 
+     * @param index - The position of the int inside of the chunk (starting at 0)
+     * @return The int at that position
+     */
+    int get(size_t index);
+
+    /**
+     * Decompresses every int of the CompressedChunk.
+     * 
+     * @param values - Where the ints are written, which must hold length() ints
+     */
+    void decode(int* values);
+
+    /**
+     * Sums every valid int of the CompressedChunk into a 64-bit integer. RLE_ENCODING adds each
+     * run as its value times the number of valid cells in it (a popcount of valid over the rows
+     * of the run), and FOR_ENCODING adds the packed differences to the number of valid cells
+     * times the reference, so neither is decoded. DELTA_ENCODING, and FOR_ENCODING when any cell
+     * is missing, are decoded a DELTA_BLOCK at a time into a stack buffer and summed with
+     * sum_kernel(...) (see kernels.h), which skips the missing cells.
+     * 
+     * @param valid - The validity words of the chunk (see the MISSING section of column.h), or
+     * nullptr if every cell holds a value
+     * @return The sum of every valid int, 0 if there are none
+     */
+    int64_t sum(const uint64_t* valid);
+
+    /**
+     * Finds the smallest and largest valid int of the CompressedChunk. RLE_ENCODING only visits
+     * the value of each run holding a valid cell, and FOR_ENCODING only the packed differences.
+     * When any cell is missing, FOR_ENCODING and DELTA_ENCODING are decoded a DELTA_BLOCK at a
+     * time and reduced with min_max_kernel(...) (see kernels.h), so the 0 held by a missing cell
+     * is never counted.
+     * 
+     * @param valid - The validity words of the chunk (see the MISSING section of column.h), or
+     * nullptr if every cell holds a value
+     * @param min - Where the smallest valid int is written
+     * @param max - Where the largest valid int is written
+     * @return True if any cell was valid, false if there were none (and nothing is written)
+     */
+    bool min_max(const uint64_t* valid, int* min, int* max);
+
+    /**
+     * Finds every int of the CompressedChunk equal to int_value, working on the encoded form.
+     * 
+     * @param int_value - The int that every cell will be compared to
+     * @param words - The words bit i of the chunk is written to, as in a Bitmap, which must hold
+     * (length() + 63) / 64 words that are all 0 beforehand
+     */
+    void match(int int_value, uint64_t* words);
+
+    protected:
+    /* The encoding of the ints */
+    IntEncoding encoding_;
+
+    /* The number of ints */
+    size_t length_;
+
+    /* RLE_ENCODING: the int of each run, and the row just past the end of each run */
+    int* run_values_;
+    uint32_t* run_ends_;
+    size_t num_runs_;
+
+    /* FOR_ENCODING: the smallest int, DELTA_ENCODING: the smallest difference */
+    int64_t reference_;
+
+    /* FOR_ENCODING and DELTA_ENCODING: the number of bits of each packed difference (0 to 33) */
+    uint8_t bit_width_;
+
+    /* FOR_ENCODING and DELTA_ENCODING: the packed differences, length_ * bit_width_ bits */
+    uint64_t* packed_;
+
+    /* DELTA_ENCODING: the full int at the start of each block of DELTA_BLOCK cells */
+    int* block_starts_;
+};
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stdint.h>
+#include "object.h"
+
+/**
+ * The binary file format used by DataFrame::save(...) and DataFrame::open(...).
+ * 
+ * All numbers are little-endian, and every block starts on a multiple of DATAFILE_ALIGNMENT bytes
+ * from the start of the file, so that a mapped block can be used directly as the chunks of a
+ * Column. Every chunk of CHUNK_SIZE ints, floats or codes (16 KiB) is then page aligned, while the
+ * 512-byte chunks of a BoolColumn are only aligned to 512 bytes, 8 to a page.
+ * 
+ *      FILE HEADER (32 bytes)
+ *          char[8]   magic         - DATAFILE_MAGIC
+ *          uint32_t  version       - DATAFILE_VERSION
+ *          uint32_t  ncol          - The number of columns
+ *          uint64_t  nrow          - The number of rows of every column
+ *          uint64_t  directory     - The offset of the column directory
+ * 
+ *      COLUMN DIRECTORY (ncol entries of 56 bytes)
+ *          uint32_t  tag           - A ColumnTag, matching is_int_column(), is_float_column(), ...
+ *          uint32_t  flags         - DATAFILE_VALIDITY if a validity block follows the data
+ *                                    block, 0 otherwise
+ *          uint64_t  header        - The offset of the header characters, 0 if no header
+ *          uint64_t  header_size   - The number of header characters (no '\0')
+ *          uint64_t  data          - The offset of the data block
+ *          uint64_t  data_size     - The number of bytes of the data block
+ *          uint64_t  dictionary    - The offset of the dictionary block, 0 if not a StringColumn
+ *          uint64_t  zones         - The offset of the zone map block, 0 if not an INT_TAG or
+ *                                    FLOAT_TAG column
+ * 
+ *      DATA BLOCKS
+ *          INT_TAG     - nrow int32_t cells
+ *          FLOAT_TAG   - nrow IEEE-754 float cells
+ *          BOOL_TAG    - (nrow + 63) / 64 uint64_t words, packed the same as a BoolColumn
+ *          STRING_TAG  - nrow uint32_t dictionary codes
+ * 
+ *      DICTIONARY BLOCKS (StringColumns only)
+ *          uint64_t  size          - The number of unique Strings
+ *          uint64_t  offsets[size + 1] - The offset of each String inside of chars, and the end
+ *          char      chars[]       - The characters of every String, back to back (no '\0')
+ * 
+ *      VALIDITY BLOCKS (Columns with missing cells only)
+ *          uint64_t  words[(nrow + 63) / 64] - Bit r set if row r holds a value, starting on the
+ *                                    next multiple of DATAFILE_ALIGNMENT after the data block
+ * 
+ *      ZONE MAP BLOCKS (INT_TAG and FLOAT_TAG only)
+ *          pairs[(nrow + CHUNK_SIZE - 1) / CHUNK_SIZE] - The chunk_min(...) and chunk_max(...) of
+ *                                    each chunk, as two int32_t or two IEEE-754 floats
+ * 
+ * Every StringColumn is written dictionary-encoded, whether or not it is encoded in memory.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+/* The first 8 bytes of every DataFrame file */
+#define DATAFILE_MAGIC "DFRAME\0\0"
+
+/* The version of the format described above, the only version open(...) accepts */
+static const uint32_t DATAFILE_VERSION = 1;
+
+/* The flag of a column directory entry whose column has a validity block */
+static const uint32_t DATAFILE_VALIDITY = 1;
+
+/* The alignment in bytes of every block inside of a DataFrame file */
+static const size_t DATAFILE_ALIGNMENT = 4096;
+
+/* The type of a column inside of a DataFrame file */
+enum ColumnTag {
+    INT_TAG = 1,
+    FLOAT_TAG = 2,
+    BOOL_TAG = 3,
+    STRING_TAG = 4
+};
+
+/**
+ * A read-only memory map of a whole file. Opening the map does not read the file, pages are only
+ * read from disk (or the page cache) the first time they are touched.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class MappedFile : public Object {
+    public:
+    /**
+     * Maps a file into memory.
+     * 
+     * NOTE: If the file cannot be opened or mapped, then an "error" will be thrown.
+     * 
+     * @param path - The path of the file to be mapped
+     */
+    MappedFile(const char* path);
+
+    /* Unmaps the file and closes it */
+    ~MappedFile();
+
+    /**
+     * Gets the mapped bytes of the file.
+     * 
+     * @return A pointer to the first byte of the file
+     */
+    const char* get_data();
+
+    /**
+     * Returns the number of bytes inside of the file.
+     * 
+     * @return The size of the file
+     */
+    size_t size();
+
+    /**
+     * Checks whether a pointer points inside of the mapped file.
+     * 
+     * @param ptr - The pointer to be checked
+     * @return True if ptr is inside of the mapped bytes, false otherwise
+     */
+    bool contains(const void* ptr);
+
+    protected:
+    /* The mapped bytes of the file */
+    char* data_;
+
+    /* The number of bytes inside of the file */
+    size_t size_;
+
+    /* The file descriptor of the open file */
+    int fd_;
+};
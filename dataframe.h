@@ -3,20 +3,86 @@
 #include "string.h"
 #include "object.h"
 #include "column.h"
+#include "bitmap.h"
+#include "threadpool.h"
+#include "datafile.h"
+#include "index.h"
+#include "stats.h"
 #include <stdarg.h>
 
+class DataFrameView;
+class Predicate;
+class GroupBy;
+class Rower;
+class Snapshot;
+
+/* The kinds of join between two DataFrames (see join.h) */
+enum JoinType {
+    INNER_JOIN,
+    LEFT_JOIN
+};
+
 /**
  * A dataframe is used for storing data tables. It is an ordered sequence of 
  * (optionally named) columns of equal length.
  * 
  * Spec here: http://janvitek.org/events/NEU/4500/s20/projects2.html
  * 
+ * PARALLELISM: When a ThreadPool is given with set_thread_pool(...), queries split the rows into
+ * morsels of MORSEL_SIZE physical rows (see DELETION below) and run them as Tasks on the
+ * ThreadPool. Each morsel starts on a multiple of MORSEL_SIZE, so it writes to its own words of
+ * the result Bitmap, and the rows of the result are kept in the same order as the DataFrame.
+ * 
+ * CONCURRENCY: Only one thread may change a DataFrame (or its Columns) at a time, and no other
+ * thread may read it directly while it does. Other threads should read through Snapshots taken
+ * with snapshot(), which never lock and never see a change until the writer calls publish()
+ * (see snapshot.h).
+ * 
+ * MEMORY: A DataFrame does NOT own the Columns or Strings that are given to it (such as with
+ * DataFrame(...) or set(...)), and they must be deleted by the caller after the DataFrame.
+ * The DataFrame owns every Column it creates itself (the Columns of a DataFrame made by
+ * query(...), get_row(...), open(...), a Loader, etc.), which live on the heap and are deleted
+ * with the DataFrame. The chunks and Strings of those Columns are carved out of the DataFrame's
+ * own Arena (see arena.h), and are freed all at once when the DataFrame is deleted, while chunks
+ * replaced before then (by copy-on-write or compact()) are given back with Arena::recycle(...).
+ * Strings returned by the get_*(...) functions are never owned by the caller.
+ * 
+ * DELETION: remove_row(...) does not shift any cells, it only marks the row as deleted in a
+ * tombstone Bitmap. Until compact() there are two ways of numbering rows:
+ *      logical row  - Counts only the rows that are not deleted, from 0 to nrow(). Every row
+ *                     index passed to or returned by the DataFrame (such as the row of
+ *                     get_int(...), set(...), remove_row(...) or get_row(...)) is logical.
+ *      physical row - The position of the cells inside of the Columns, from 0 to nrow() +
+ *                     num_deleted(), counting deleted rows too. Every Bitmap exchanged with the
+ *                     DataFrame (Column::match(...), select(...), filter(...), FusedScan, and the
+ *                     rows of a ColumnIndex) has one bit per physical row, so scans, morsels and
+ *                     chunks stay lined up with each other no matter how many rows are deleted.
+ * Logical rows are turned into physical rows with a rank directory: a Fenwick tree holding the
+ * number of live rows of each chunk. physical_row(...) finds the chunk in O(log num_chunks) and
+ * then the row inside it with a popcount of at most Column::CHUNK_SIZE / 64 tombstone words, and
+ * remove_row(...) updates the tree in O(log num_chunks), so deleting in a loop stays
+ * O(n log n). Queries clear the deleted rows from their physical Bitmaps a word at a time. The
+ * deleted rows are only removed from the Columns by compact(), which rewrites each Column in one
+ * pass (after which logical and physical rows are the same again), and which is called
+ * automatically once the deleted rows make up more than the compaction threshold.
+ * 
+ * MISSING: A cell can be missing instead of holding a value (see is_missing(...)), which is
+ * tracked by the validity bitmap of its Column. Queries AND their result Bitmap with the validity
+ * words of the queried Column, so a missing cell never matches, and aggregations (see groupby.h)
+ * and reductions (see kernels.h) skip missing cells the same way. Sorting puts missing cells
+ * after every value, whether ascending or not (keeping their order), top_k(...) never keeps a
+ * missing cell, a missing key never joins with anything, and a missing cell only equals another
+ * missing cell.
+ * 
  * Authors: 
  *      csstransky - stransky.c@husky.neu.edu
  *      kaylindevchand - devchand.k@husky.neu.edu
  */
 class DataFrame : public Object {
     public:
+    /* The number of rows handed to each Task of a parallel query, a multiple of CHUNK_SIZE */
+    static const size_t MORSEL_SIZE = 16 * Column::CHUNK_SIZE;
+
     /* Creates an empty DataFrame */
     DataFrame();
 
@@ -24,10 +90,11 @@ class DataFrame : public Object {
      * Creates a DataFrame with columns.
      * 
      * NOTE: Any Columns that have less rows than the Column with the maximum amount of rows, will
-     * have rows added to it (with default values) until that Column has an equal length of rows.
-     * This is to ensure that all Columns in the DataFrame have EQUAL length.
+     * have missing cells added to it (see Column::add_missing(...)) until that Column has an
+     * equal length of rows. This is to ensure that all Columns in the DataFrame have EQUAL length.
      * 
-     * NOTE: The default value for each Column will be specified in the respective Column comments.
+     * NOTE: A missing cell holds the default value of its Column, which is specified in the
+     * respective Column comments, but is_missing(...) tells it apart from a real value.
      * 
      * @param columns - The premade columns to be added to the DataFrame
      */
@@ -35,9 +102,49 @@ class DataFrame : public Object {
 
     /**
      * Deconstructs the DataFrame.
+     * 
+     * NOTE: A DataFrame made by open(...) also unmaps its file.
+     * NOTE: Every Column created by the DataFrame is deleted, and their chunks and Strings are
+     * freed with its Arena.
      */
     ~DataFrame();
 
+    /**
+     * Gets the Arena that the DataFrame creates the chunks and Strings of its Columns inside of.
+     * 
+     * @return The Arena owned by the DataFrame
+     */
+    Arena* get_arena();
+
+    /**
+     * Opens a DataFrame that was written by save(...). The file is memory mapped, and each Column
+     * reads its cells straight from the mapped file, so only the file header, the column headers,
+     * the String dictionaries and the zone maps are read when opening. Every other cell is only
+     * read from disk the first time it is touched.
+     * 
+     * NOTE: If the file cannot be opened, or is not a DataFrame file of DATAFILE_VERSION, then an
+     * "error" will be thrown. Validity blocks are mapped as lazily as the cells.
+     * 
+     * @param path - The path of the file to be opened
+     * @return A new DataFrame which owns the MappedFile, so care should be taken to delete it
+     */
+    static DataFrame* open(const char* path);
+
+    /**
+     * Writes the DataFrame into a binary file in the format described in datafile.h, so that it
+     * can later be opened with open(...). The file is written to a temporary file next to path
+     * (path followed by ".tmp"), flushed with fsync(...), and only then moved over path with
+     * rename(...). Any file already at path is replaced in one step, and a MappedFile still open
+     * on it (such as the file this DataFrame was opened from) keeps reading the old file, so
+     * saving over the file a DataFrame is mapped from never truncates pages in use.
+     * 
+     * NOTE: If the file cannot be written, then an "error" will be thrown, the temporary file is
+     * removed, and any file already at path is left untouched.
+     * 
+     * @param path - The path of the file to be written, replacing any file already there
+     */
+    void save(const char* path);
+
     /**
      * Prints a representation of the DataFrame into the console, with the header as the
      * first line, and then the subsequent rows of the DataFrame.
@@ -157,6 +264,27 @@ class DataFrame : public Object {
      */
     void set(size_t row, size_t column, String* string_value);
 
+    /**
+     * Finds whether a cell of the DataFrame is missing, from the validity bitmap of its Column.
+     * 
+     * NOTE: If row and column are out of bounds, then an "error" will be thrown.
+     * 
+     * @param row - The numbered row of the DataFrame (starting from 0)
+     * @param column - The numbered column of the DataFrame (starting from 0)
+     * @return True if the cell has no value, false if it holds a value (even a 0 or "")
+     */
+    bool is_missing(size_t row, size_t column);
+
+    /**
+     * Marks a cell of the DataFrame as missing. Any set(...) of the cell makes it valid again.
+     * 
+     * NOTE: If row and column are out of bounds, then an "error" will be thrown.
+     * 
+     * @param row - The numbered row of the DataFrame (starting from 0)
+     * @param column - The numbered column of the DataFrame (starting from 0)
+     */
+    void set_missing(size_t row, size_t column);
+
     /**
      * Checks to see if this column is a BoolColumn.
      * 
@@ -201,6 +329,8 @@ class DataFrame : public Object {
      * Gets all the headers of the DataFrame into an array of String*.
      * 
      * NOTE: If a column does not have a defined header, it will return a nullptr.
+     * NOTE: The array is new and must be deleted by the caller, but the Strings inside of it are
+     * still owned by the Columns, and must NOT be deleted.
      * 
      * @return A String* array of all the headers for each column
      */
@@ -235,11 +365,67 @@ class DataFrame : public Object {
      */
     Column* get_column(size_t index);
 
+    /**
+     * Gets a Column from the DataFrame as an IntColumn*, checking its type only once. The
+     * non-virtual get(...), put(...), get_chunk(...) and get_chunk_const(...) functions of the
+     * IntColumn can then be used in a tight loop, without a virtual call or type check for each
+     * cell.
+     * 
+     * NOTE: If the index is out of bounds, or the Column is not an IntColumn, then an "error" will
+     * be thrown.
+     * 
+     * @param index - The numbered column of the DataFrame (starting from 0)
+     * @return The Column at index, which is still owned by the DataFrame
+     */
+    IntColumn* as_int_column(size_t index);
+
+    /**
+     * Gets a Column from the DataFrame as a FloatColumn*, checking its type only once. The
+     * non-virtual get(...), put(...), get_chunk(...) and get_chunk_const(...) functions of the
+     * FloatColumn can then be used in a tight loop, without a virtual call or type check for each
+     * cell.
+     * 
+     * NOTE: If the index is out of bounds, or the Column is not a FloatColumn, then an "error" will
+     * be thrown.
+     * 
+     * @param index - The numbered column of the DataFrame (starting from 0)
+     * @return The Column at index, which is still owned by the DataFrame
+     */
+    FloatColumn* as_float_column(size_t index);
+
+    /**
+     * Gets a Column from the DataFrame as a BoolColumn*, checking its type only once. The
+     * non-virtual get(...), put(...), get_chunk(...) and get_chunk_const(...) functions of the
+     * BoolColumn can then be used in a tight loop, without a virtual call or type check for each
+     * cell.
+     * 
+     * NOTE: If the index is out of bounds, or the Column is not a BoolColumn, then an "error" will
+     * be thrown.
+     * 
+     * @param index - The numbered column of the DataFrame (starting from 0)
+     * @return The Column at index, which is still owned by the DataFrame
+     */
+    BoolColumn* as_bool_column(size_t index);
+
+    /**
+     * Gets a Column from the DataFrame as a StringColumn*, checking its type only once. The
+     * non-virtual get(...), put(...), get_chunk(...) and get_chunk_const(...) functions of the
+     * StringColumn can then be used in a tight loop, without a virtual call or type check for each
+     * cell.
+     * 
+     * NOTE: If the index is out of bounds, or the Column is not a StringColumn, then an "error"
+     * will be thrown.
+     * 
+     * @param index - The numbered column of the DataFrame (starting from 0)
+     * @return The Column at index, which is still owned by the DataFrame
+     */
+    StringColumn* as_string_column(size_t index);
+
     /**
      * Sets the Column for the DataFrame.
      * 
      * NOTE: If the column being set has less rows than the number of rows in the DataFrame, then
-     * the Column will fill automatically fill in the rest of its rows with a default value.
+     * the Column will automatically fill in the rest of its rows with missing cells.
      * 
      * @param index - The numbered column of the DataFrame (starting from 0)
      * @param column - The Column to be set at index in the DataFrame
@@ -268,7 +454,7 @@ class DataFrame : public Object {
     /**
      * The number of data rows in the DataFrame.
      * 
-     * @return The number of rows in the DataFrame.
+     * @return The number of rows in the DataFrame, not counting deleted rows.
      */
     size_t nrow();
 
@@ -290,20 +476,85 @@ class DataFrame : public Object {
      * empty values in the cells of each Column.
      * 
      * NOTE: If row is out of bounds, then an "error" will be thrown.
+     * NOTE: Every cell after row is shifted down in each Column, and any deleted rows are
+     * compacted first. Use add_rows(...) to add many rows at once.
      * 
      * @param row - The numbered row of the DataFrame (starting from 0)
      */
     void add_row(size_t row);
 
+    /**
+     * Adds many empty rows to the DataFrame at once, with respective default empty values in the
+     * cells of each Column. Each Column is only shifted once, in a single pass, no matter how many
+     * rows are added. Any deleted rows are compacted first.
+     * 
+     * NOTE: If any row is out of bounds, then an "error" will be thrown.
+     * 
+     * @param rows - The numbered rows of the DataFrame (starting from 0) that an empty row will
+     * be added before, in increasing order. The same row may be given more than once.
+     * @param num_rows - The number of rows inside of rows
+     */
+    void add_rows(size_t* rows, size_t num_rows);
+
     /**
      * Removes the specified row from the DataFrame, and its corresponding Columns.
      * 
      * NOTE: If row is out of bounds, then an "error" will be thrown.
+     * NOTE: The row is only marked as deleted, which is O(log num_chunks) to find the row and
+     * update the rank directory. Its cells are removed from the Columns by the next compact().
      * 
      * @param row - The numbered row of the DataFrame (starting from 0)
      */
     void remove_row(size_t row);
 
+    /**
+     * Removes the cells of every deleted row from every Column, each Column in a single pass.
+     * Nothing happens if no rows are deleted.
+     */
+    void compact();
+
+    /**
+     * The number of rows that have been deleted with remove_row(...) but not yet compacted.
+     * 
+     * @return The number of deleted rows still held by the Columns.
+     */
+    size_t num_deleted();
+
+    /**
+     * Turns a logical row into the physical row that holds its cells, using the rank directory
+     * (see DELETION above). This is O(log num_chunks), and O(1) if no rows are deleted.
+     * 
+     * NOTE: If row is out of bounds, then an "error" will be thrown.
+     * 
+     * @param row - The logical row of the DataFrame (starting from 0)
+     * @return The physical row, from 0 to nrow() + num_deleted()
+     */
+    size_t physical_row(size_t row);
+
+    /**
+     * Turns a physical row (such as a set bit of a Bitmap from filter(...)) back into a logical
+     * row, by counting the live rows before it with the rank directory. This is
+     * O(log num_chunks), and O(1) if no rows are deleted.
+     * 
+     * NOTE: If the physical row is out of bounds, or has been deleted, then an "error" will be
+     * thrown.
+     * 
+     * @param physical - The physical row of the DataFrame (starting from 0)
+     * @return The logical row, from 0 to nrow()
+     */
+    size_t logical_row(size_t physical);
+
+    /**
+     * Sets the fraction of deleted rows that will make remove_row(...) call compact(). The default
+     * is 0.25, meaning a compaction happens once a quarter of the held rows are deleted.
+     * 
+     * NOTE: If threshold is not between 0 and 1, then an "error" will be thrown. A threshold of 0
+     * compacts after every remove_row(...), and a threshold of 1 never compacts automatically.
+     * 
+     * @param threshold - The fraction of held rows that may be deleted before compacting
+     */
+    void set_compaction_threshold(float threshold);
+
     /**
      * Inserts a DataFrame "below" the specified row. 
      * Example:
@@ -331,10 +582,42 @@ class DataFrame : public Object {
      */
     void insert(size_t row, DataFrame* df);
 
+    /**
+     * Adds many empty rows to the end of the DataFrame, with respective default empty values in
+     * the cells of each Column. Whole chunks are added to each Column at once.
+     * 
+     * @param num_rows - The number of rows to be added
+     */
+    void append_rows(size_t num_rows);
+
+    /**
+     * Adds every row of another DataFrame to the end of this DataFrame. The types of the Columns
+     * are only checked once, and the cells of each Column are then copied a chunk at a time
+     * (with append(...) on each Column) instead of one cell at a time.
+     * 
+     * NOTE: The df's Columns MUST match the same type of Columns (IntColumn, FloatColumn, etc.) 
+     * of the original DataFrame, otherwise an "error" will be thrown.
+     * 
+     * @param df - The DataFrame whose rows will be added, which is not changed
+     */
+    void append_rows(DataFrame* df);
+
+    /**
+     * Gets a read-only view of every row of the DataFrame, without copying any cells. Queries
+     * on the view return more views, so results can be drilled down into without copying, and
+     * only materialized with DataFrameView::to_dataframe() once needed (see view.h).
+     * 
+     * @return A new DataFrameView of this DataFrame, so care should be taken to delete it
+     */
+    DataFrameView* view();
+
     /**
      * Gets a mini DataFame of 1 row that holds all the values from the main DataFrame at a
      * specified row index. This will return a new DataFrame, so care should be taken to delete it.
      * 
+     * NOTE: To read a row without copying it, use DataFrameView::get_row(...) on a view(), or
+     * visit every row with map(...).
+     * 
      * NOTE: If row is out of bounds, then an "error" will be thrown.
      * 
      * @param row - The numbered row of the DataFrame (starting from 0)
@@ -342,6 +625,77 @@ class DataFrame : public Object {
      */
     DataFrame* get_row(size_t row);
 
+    /**
+     * Attaches a ColumnIndex to a column, so that query(...) on that column finds its matching
+     * rows without a full scan. Any ColumnIndex already on the column is replaced.
+     * 
+     * NOTE: If the column is out of bounds, or is a BoolColumn, then an "error" will be thrown.
+     * 
+     * @param column - The numbered column of the DataFrame (starting from 0)
+     * @param kind - SORTED_INDEX for range lookups, or HASH_INDEX for the fastest point lookups
+     */
+    void create_index(size_t column, IndexKind kind);
+
+    /**
+     * Removes and deletes the ColumnIndex of a column, if it has one.
+     * 
+     * NOTE: If the column is out of bounds, then an "error" will be thrown.
+     * 
+     * @param column - The numbered column of the DataFrame (starting from 0)
+     */
+    void drop_index(size_t column);
+
+    /**
+     * Gets the ColumnIndex of a column.
+     * 
+     * NOTE: If the column is out of bounds, then an "error" will be thrown.
+     * 
+     * @param column - The numbered column of the DataFrame (starting from 0)
+     * @return The ColumnIndex owned by the DataFrame, or nullptr if the column has none
+     */
+    ColumnIndex* get_index(size_t column);
+
+    /**
+     * Compresses every IntColumn of the DataFrame with IntColumn::compress(), so each full chunk
+     * is stored with whichever of run-length, delta or frame-of-reference encoding is smallest.
+     * Other Columns are left as they are.
+     */
+    void compress();
+
+    /**
+     * Sets the ThreadPool that queries of the DataFrame run on. The size of the ThreadPool sets
+     * how many threads a query will use. A DataFrame with fewer than 2 * MORSEL_SIZE rows is
+     * always queried on the calling thread. The ThreadPool is also given to every Column of the
+     * DataFrame (see Column::set_thread_pool(...)).
+     * 
+     * NOTE: The DataFrame does not take ownership of the ThreadPool, so one ThreadPool can be
+     * shared by many DataFrames. It MUST outlive every DataFrame that it is set on.
+     * 
+     * @param pool - The ThreadPool to run queries on, or nullptr to query on the calling thread
+     */
+    void set_thread_pool(ThreadPool* pool);
+
+    /**
+     * Gets the ThreadPool that queries of the DataFrame run on.
+     * 
+     * @return The ThreadPool, or nullptr if queries run on the calling thread (the default)
+     */
+    ThreadPool* get_thread_pool();
+
+    /**
+     * Gets a sub DataFrame made of the rows selected by a Bitmap, such as the Bitmap returned by
+     * the match(...) function of a Column. The matching rows are found a whole word at a time, and
+     * the number of rows in the sub DataFrame is known up front from a popcount.
+     * 
+     * NOTE: If the Bitmap is not the same size as nrow() + num_deleted(), then an "error" will be
+     * thrown. Deleted rows are never selected, even if their bits are set.
+     * 
+     * @param rows - The Bitmap with bit r set for every physical row r to be kept
+     * @return A sub DataFrame with the selected rows, the order of the rows in the sub DataFrame
+     * will be the same as the main DataFrame.
+     */
+    DataFrame* select(Bitmap* rows);
+
     /**
      * Gets a sub DataFrame with all elements matching the given string_value from the specified
      * col index.
@@ -349,6 +703,12 @@ class DataFrame : public Object {
      * NOTE: If the col is out of bounds, or if the Column specified is not a StringColumn,
      * then an "error" will be thrown.
      * 
+     * NOTE: If the StringColumn is dictionary-encoded, string_value is only looked up once and
+     * the Column is then scanned by comparing codes (see StringColumn::encode()).
+     * 
+     * NOTE: If the column has a ColumnIndex (see create_index(...)), the matching rows are found
+     * with ColumnIndex::lookup(...) instead of scanning the Column.
+     * 
      * @param col - The numbered column of the DataFrame (starting from 0)
      * @param string_value - The String that will match with all the values queried
      * @return A sub DataFrame with elements all equal to the string_value in the chosen Column,
@@ -363,6 +723,10 @@ class DataFrame : public Object {
      * NOTE: If the col is out of bounds, or if the Column specified is not a BoolColumn,
      * then an "error" will be thrown.
      * 
+     * NOTE: The BoolColumn is matched 64 rows at a time using its packed words (inverted when
+     * bool_value is false), so only the set bits of each word are ever visited. The number of
+     * matching rows is known up front from a popcount.
+     * 
      * @param col - The numbered column of the DataFrame (starting from 0)
      * @param bool_value - The Boolean that will match with all the values queried
      * @return A sub DataFrame with elements all equal to the bool_value in the chosen Column,
@@ -377,6 +741,12 @@ class DataFrame : public Object {
      * NOTE: If the col is out of bounds, or if the Column specified is not a IntColumn,
      * then an "error" will be thrown.
      * 
+     * NOTE: The Column is compared a chunk at a time with a SIMD scan (see scan.h) into a
+     * Bitmap, and the sub DataFrame is built from that Bitmap with select(...). Chunks whose zone
+     * map cannot hold int_value are skipped, and compressed chunks are compared on their encoded
+     * form (see compress()). If the column has a ColumnIndex (see create_index(...)), the
+     * matching rows are found with ColumnIndex::lookup(...) instead.
+     * 
      * @param col - The numbered column of the DataFrame (starting from 0)
      * @param int_value - The integer that will match with all the values queried
      * @return A sub DataFrame with elements all equal to the int_value in the chosen Column,
@@ -391,10 +761,177 @@ class DataFrame : public Object {
      * NOTE: If the col is out of bounds, or if the Column specified is not a FloatColumn,
      * then an "error" will be thrown.
      * 
+     * NOTE: The Column is compared a chunk at a time with a SIMD scan (see scan.h) into a
+     * Bitmap, and the sub DataFrame is built from that Bitmap with select(...). Chunks whose zone
+     * map cannot hold float_value are skipped. If the column has a ColumnIndex (see
+     * create_index(...)), the matching rows are found with ColumnIndex::lookup(...) instead.
+     * 
      * @param col - The numbered column of the DataFrame (starting from 0)
      * @param float_value - The float that will match with all the values queried
      * @return A sub DataFrame with elements all equal to the float_value in the chosen Column,
      * the order of the elements in the sub DataFrame will be the same as the main DataFrame.
      */
     DataFrame* query(size_t col, float float_value);
+
+    /**
+     * Finds every row matching a Predicate. The Predicate is compiled into a FusedScan (see
+     * predicate.h), so every column it involves is filtered in a single pass.
+     * 
+     * NOTE: If predicate->check(this) is false, then an "error" will be thrown.
+     * 
+     * @param predicate - The Predicate to filter with, which is NOT owned by the DataFrame
+     * @return A new Bitmap of nrow() + num_deleted() bits, where bit r is set if physical row r
+     * matched and is not deleted
+     */
+    Bitmap* filter(Predicate* predicate);
+
+    /**
+     * Gets a sub DataFrame with all rows matching a Predicate, such as a range, an inequality,
+     * or an AND/OR of comparisons on many columns. This is select(filter(predicate)).
+     * 
+     * NOTE: If predicate->check(this) is false, then an "error" will be thrown.
+     * 
+     * @param predicate - The Predicate to filter with, which is NOT owned by the DataFrame
+     * @return A sub DataFrame with the matching rows, the order of the rows in the sub DataFrame
+     * will be the same as the main DataFrame.
+     */
+    DataFrame* query(Predicate* predicate);
+
+    /**
+     * Groups the rows of the DataFrame by the values of one or more columns, so that aggregates
+     * (such as SUM_AGG or MEAN_AGG) of the other columns can be computed for each group (see
+     * groupby.h).
+     * 
+     * NOTE: If num_keys is 0 or any key column is out of bounds, then an "error" will be thrown.
+     * 
+     * @param key_cols - The numbered columns to group by (starting from 0), which are copied
+     * @param num_keys - The number of columns inside of key_cols
+     * @return A new GroupBy of this DataFrame, so care should be taken to delete it
+     */
+    GroupBy* group_by(size_t* key_cols, size_t num_keys);
+
+    /**
+     * Joins this DataFrame (on the left) with another DataFrame (on the right), matching rows
+     * whose key columns are equal. This is the same as a Join with one pair of key columns and
+     * AUTO_JOIN (see join.h).
+     * 
+     * NOTE: If either column is out of bounds, or the two Columns are not the same type, then an
+     * "error" will be thrown.
+     * 
+     * @param right - The DataFrame to be joined with, which is not changed
+     * @param left_col - The numbered key column of this DataFrame (starting from 0)
+     * @param right_col - The numbered key column of right (starting from 0)
+     * @param type - INNER_JOIN or LEFT_JOIN
+     * @return A new DataFrame with the joined rows, so care should be taken to delete it
+     */
+    DataFrame* join(DataFrame* right, size_t left_col, size_t right_col, JoinType type);
+
+    /**
+     * Finds the order of the rows of the DataFrame when sorted by one or more columns, without
+     * moving any rows. The sort is stable, and later columns only break ties of earlier columns.
+     * 
+     * IntColumn, FloatColumn and BoolColumn keys are sorted with an LSD radix sort on their bits
+     * (with floats flipped so that their bits sort in numeric order). StringColumn keys are sorted
+     * by the first 8 bytes of each String, with String::cmp(...) only called to break ties of
+     * equal prefixes. A dictionary-encoded StringColumn is instead radix sorted on the rank of
+     * each code (see StringDictionary::ranks()), which gives the same order as String::cmp(...).
+     * Missing cells sort after every value of their column, in ascending and descending order
+     * alike, and keep their order among themselves.
+     * 
+     * NOTE: If num_cols is 0 or any column is out of bounds, then an "error" will be thrown.
+     * 
+     * @param cols - The numbered columns to sort by (starting from 0), most important first
+     * @param ascending - For each column, true to sort smallest first, false for largest first
+     * @param num_cols - The number of columns inside of cols and ascending
+     * @return A new array of nrow() row indices in sorted order, so care should be taken to
+     * delete it
+     */
+    size_t* sort_permutation(size_t* cols, bool* ascending, size_t num_cols);
+
+    /**
+     * Sorts the rows of the DataFrame by one or more columns. The order is found with
+     * sort_permutation(...), and then each Column is rearranged in place with a single
+     * Column::permute(...), instead of swapping whole rows. The DataFrame keeps owning the same
+     * Columns, so any Column pointer from get_column(...) or as_*_column(...) is still valid, and
+     * sees the sorted cells. Deleted rows are removed with compact() first, so that the logical
+     * rows of sort_permutation(...) are also the physical rows of every Column.
+     * 
+     * NOTE: If num_cols is 0 or any column is out of bounds, then an "error" will be thrown.
+     * 
+     * @param cols - The numbered columns to sort by (starting from 0), most important first
+     * @param ascending - For each column, true to sort smallest first, false for largest first
+     * @param num_cols - The number of columns inside of cols and ascending
+     */
+    void sort_by(size_t* cols, bool* ascending, size_t num_cols);
+
+    /**
+     * Gets the k rows with the largest (or smallest) values in a column, without sorting the
+     * DataFrame. The column is read a chunk at a time into a heap that never holds more than k
+     * rows, so this takes O(n log k) time and O(k) memory.
+     * 
+     * NOTE: If the column is out of bounds, or is not an IntColumn, FloatColumn or StringColumn,
+     * then an "error" will be thrown. If k is more than nrow(), every row is returned.
+     * NOTE: Strings are ordered by String::cmp(...), using StringDictionary::ranks() if the
+     * StringColumn is dictionary-encoded. Rows whose cell is missing are never kept.
+     * 
+     * @param col - The numbered column of the DataFrame (starting from 0)
+     * @param k - The number of rows to keep
+     * @param largest - True to keep the largest values, false to keep the smallest
+     * @return A new DataFrame of the kept rows, ordered from the largest (or smallest) value, so
+     * care should be taken to delete it
+     */
+    DataFrame* top_k(size_t col, size_t k, bool largest);
+
+    /**
+     * Visits every row of the DataFrame in order with a Rower, on the calling thread. Each row is
+     * given to Rower::accept(...) as the same Row (see row.h) moved from row to row, so no
+     * DataFrame or Row is allocated for each row.
+     * 
+     * @param r - The Rower that visits the rows, which is NOT owned by the DataFrame
+     */
+    void map(Rower* r);
+
+    /**
+     * Visits every row of the DataFrame with a Rower, in parallel. The rows are split into one
+     * contiguous range for each thread of the ThreadPool (each a whole number of MORSEL_SIZE
+     * rows, except the last), and each range is visited in order by its own clone of the Rower
+     * (see Rower::clone()) in its own Task. The clones are then joined back into r with
+     * Rower::join_delete(...) in the order of their ranges, so r sees every row in order even
+     * if its join_delete(...) is order-sensitive. Without a ThreadPool, this is the same as
+     * map(...).
+     * 
+     * @param r - The Rower that the results are joined into, which is NOT owned by the DataFrame
+     */
+    void pmap(Rower* r);
+
+    /**
+     * Takes an immutable, consistent Snapshot of the DataFrame as of the last publish(). This
+     * never locks and never copies any cells, and is safe to call from any thread while the
+     * writer thread is changing the DataFrame.
+     * 
+     * @return A new Snapshot, so care should be taken to delete it
+     */
+    Snapshot* snapshot();
+
+    /**
+     * Makes every change made to the DataFrame since the last publish() visible to Snapshots
+     * taken from now on, with a single atomic store. Snapshots already taken are not changed.
+     * Versions whose last Snapshot was deleted since the last publish() are reclaimed here, so
+     * their chunks are recycled into the Arena on the writer thread (see snapshot.h).
+     * 
+     * NOTE: This must only be called by the writer thread.
+     */
+    void publish();
+
+    /**
+     * Gets the counters of every operation of the DataFrame and its Columns: call counts, rows
+     * touched, bytes allocated and a latency histogram for each (see stats.h). Use
+     * Stats::to_text() or Stats::to_json() to dump them.
+     * 
+     * NOTE: Operations are only counted when DATAFRAME_PROFILE is defined at compile time,
+     * otherwise every counter stays at 0.
+     * 
+     * @return The Stats owned by the DataFrame
+     */
+    Stats* stats();
 };
\ No newline at end of file
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <stdint.h>
+#include "string.h"
+#include "object.h"
+
+/**
+ * A dictionary of unique Strings, each given a 32-bit code. The characters of every String are
+ * stored once, back to back, in blocks of BLOCK_SIZE bytes (a String longer than a block gets a
+ * block of its own). A full block is never grown or moved, a new block is started instead, so
+ * the characters of every String handed out by get(...) stay where they are for as long as the
+ * dictionary lives. Codes are handed out in the order that Strings are first added (starting
+ * at 0). Strings are found with an open-addressing hash
+ * table on String::hash() and String::equals(...).
+ * 
+ * This is what backs a dictionary-encoded StringColumn (see StringColumn::encode()), where each
+ * cell only holds the code of its String.
+ * 
+ * CONCURRENCY: A StringDictionary is append-only, so one writer can intern(...) while readers
+ * (such as Snapshots, see snapshot.h) call get(...) and find(...) without locks. Readers never
+ * write anything: intern(...) builds the String of each new code on the writer thread, so get(...)
+ * only loads it. Nothing that has been handed out ever moves: the characters live in blocks that
+ * are never grown, and the Strings are never replaced. Every table a reader uses (the Strings,
+ * characters and lengths indexed by code, and the hash table with its capacity) lives in one
+ * DictionaryTable, which is published through a single pointer with an atomic release. Growing
+ * builds a whole new DictionaryTable and swaps the pointer, so a reader always pairs a hash table
+ * with its own capacity. Old DictionaryTables are kept until the dictionary is deleted. Entries
+ * are written before size() is raised with an atomic release, so a reader that loads size() with
+ * an acquire sees every code below it. A reader must ignore any code at or past the size it is
+ * reading as of (find(...) may return such a code). ranks() is rebuilt by intern(...), so it may
+ * only be called by the writer.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class StringDictionary : public Object {
+    protected:
+    /* Everything readers look up, published together through table_ (see CONCURRENCY above) */
+    class DictionaryTable : public Object {
+        public:
+        /* The String for each code, built by intern(...) and handed out by get(...) */
+        String** strings;
+
+        /* The characters of the String for each code, pointing into one of the blocks */
+        const char** chars;
+
+        /* The number of characters of the String for each code (no '\0') */
+        size_t* lengths;
+
+        /* The number of codes the tables above can hold before a new DictionaryTable is built */
+        size_t code_capacity;
+
+        /* The open-addressing hash table, holding code + 1 in each used slot and 0 if empty */
+        uint32_t* slots;
+
+        /* The number of slots inside of slots, always a power of 2 */
+        size_t slot_capacity;
+
+        /* The DictionaryTable this one replaced, kept for readers until the dictionary dies */
+        DictionaryTable* previous;
+    };
+
+    public:
+    /* The size in bytes of each block of characters */
+    static const size_t BLOCK_SIZE = 64 * 1024;
+
+    /* Constructs an empty StringDictionary */
+    StringDictionary();
+
+    /* Deconstructs the StringDictionary, every DictionaryTable, and every String of a code */
+    ~StringDictionary();
+
+    /**
+     * Gets the code for a String, adding the String to the dictionary if it is not there yet.
+     * 
+     * NOTE: The characters of the String are copied into a block, and a new String over them is
+     * built for get(...), so the caller still owns string_value.
+     * 
+     * @param string_value - The String to be found or added
+     * @return The code of the String
+     */
+    uint32_t intern(String* string_value);
+
+    /**
+     * Finds the code for a String WITHOUT adding it to the dictionary.
+     * 
+     * @param string_value - The String to be found
+     * @param code - Where the code of the String is written, if it is found
+     * @return True if the String is inside of the dictionary, false otherwise
+     */
+    bool find(String* string_value, uint32_t* code);
+
+    /**
+     * Gets the String for a code. The same String* is returned every time for the same code, as
+     * it is built once by intern(...) and never replaced.
+     * 
+     * NOTE: If the code is out of bounds, then an "error" will be thrown.
+     * 
+     * @param code - The code of the String (starting at 0)
+     * @return The String with the code, which is owned by the dictionary and must not be deleted
+     */
+    String* get(uint32_t code);
+
+    /**
+     * Returns the number of unique Strings inside of the dictionary.
+     * 
+     * @return The number of codes that have been handed out
+     */
+    size_t size();
+
+    /**
+     * Returns the number of bytes used by the characters of every String inside the blocks.
+     * 
+     * @return The number of block bytes in use
+     */
+    size_t arena_size();
+
+    /**
+     * Gets the rank of every code in sorted order, so that rank[a] < rank[b] exactly when
+     * get(a)->cmp(get(b)) < 0. Codes are handed out in first-insertion order, which says nothing
+     * about the order of the Strings, so anything that sorts or compares an encoded StringColumn
+     * (such as DataFrame::sort_permutation(...)) sorts on these ranks instead of on the codes.
+     * The table is built once by sorting the codes with String::cmp(...), and is kept until the
+     * next new String is interned.
+     * 
+     * @return The table of size() ranks, indexed by code, which is owned by the dictionary and
+     * must not be deleted
+     */
+    uint32_t* ranks();
+
+    protected:
+    /* The blocks holding the characters of every String, each followed by a '\0' */
+    char** blocks_;
+
+    /* The number of blocks inside of blocks_ */
+    size_t num_blocks_;
+
+    /* The number of block pointers blocks_ can hold before it must grow */
+    size_t blocks_capacity_;
+
+    /* The number of bytes of the last block in use */
+    size_t block_used_;
+
+    /* The number of bytes of every block in use */
+    size_t arena_used_;
+
+    /* The current DictionaryTable, only swapped with an atomic release by intern(...) */
+    DictionaryTable* table_;
+
+    /* The number of codes that have been handed out, raised with an atomic release */
+    size_t size_;
+
+    /* The rank of each code in String::cmp(...) order, nullptr until ranks() is next called */
+    uint32_t* ranks_;
+};
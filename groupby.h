@@ -0,0 +1,126 @@
+#pragma once
+
+#include "string.h"
+#include "object.h"
+#include "threadpool.h"
+#include "dataframe.h"
+
+/* The aggregates that can be computed for each group of a GroupBy */
+enum AggOp {
+    SUM_AGG,
+    COUNT_AGG,
+    MIN_AGG,
+    MAX_AGG,
+    MEAN_AGG
+};
+
+/**
+ * Groups the rows of a DataFrame by the values of one or more key columns, and computes
+ * aggregates of other columns for each group.
+ * Example:
+ *      // The sum and mean of column 2, for each pair of values in columns 0 and 1
+ *      size_t keys[2] = {0, 1};
+ *      GroupBy* gb = df->group_by(keys, 2);
+ *      DataFrame* result = gb->agg(SUM_AGG, 2)->agg(MEAN_AGG, 2)->result();
+ * 
+ * The rows are grouped with an open-addressing hash table. Each key is hashed and compared by
+ * type: ints, floats and Booleans by their value, Strings by the code of a dictionary-encoded
+ * StringColumn if there is one, and by String::hash() and String::equals(...) otherwise. Every
+ * key cell and value cell is read a chunk at a time, never with a virtual call per cell.
+ * 
+ * With a ThreadPool, each Task aggregates its own morsels of DataFrame::MORSEL_SIZE rows into its
+ * own partial hash table. The partial tables are then merged into one (adding SUMs and COUNTs,
+ * keeping the smallest MIN_AGG and largest MAX_AGG, and finishing MEAN_AGG from its sum and count).
+ * 
+ * The result DataFrame has one row per group, in the order that each group first appears in the
+ * DataFrame (with or without a ThreadPool). Its Columns are the key columns (with the same types
+ * and headers), followed by one Column for each agg(...), in the order they were added:
+ *      SUM_AGG           - A FloatColumn. Int values are summed into an int64_t for each group
+ *                          (the same as IntColumn::sum(), so the sum never overflows) and only
+ *                          rounded to a float once the group is done, float values are summed
+ *                          into a double
+ *      MIN_AGG, MAX_AGG  - The same type as the value column (an IntColumn or FloatColumn)
+ *      COUNT_AGG         - An IntColumn of the number of rows in the group whose value is not
+ *                          missing
+ *      MEAN_AGG          - A FloatColumn
+ * The header of each aggregate Column is the lower-case name of the AggOp (without "_AGG") and
+ * the value column's header, such as "sum(price)" for SUM_AGG.
+ * 
+ * Missing cells of a value column are skipped by every aggregate, a word of the validity bitmap
+ * at a time, and a group whose value cells are all missing gets a missing aggregate cell. A
+ * missing key is grouped on its own, apart from any real default value.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class GroupBy : public Object {
+    public:
+    /**
+     * Constructs a GroupBy of a DataFrame with no aggregates yet.
+     * 
+     * NOTE: If num_keys is 0 or any key column is out of bounds, then an "error" will be thrown.
+     * 
+     * @param df - The DataFrame to be grouped, which is NOT owned by the GroupBy
+     * @param key_cols - The numbered columns to group by (starting from 0), which are copied
+     * @param num_keys - The number of columns inside of key_cols
+     */
+    GroupBy(DataFrame* df, size_t* key_cols, size_t num_keys);
+
+    /* Deconstructs the GroupBy, but NOT its DataFrame */
+    ~GroupBy();
+
+    /**
+     * Adds an aggregate of a column to be computed for each group.
+     * 
+     * NOTE: If value_col is out of bounds, or op is not COUNT_AGG and the column is not an
+     * IntColumn or FloatColumn, then an "error" will be thrown.
+     * 
+     * @param op - The aggregate to be computed
+     * @param value_col - The numbered column of the DataFrame (starting from 0) to aggregate
+     * @return This GroupBy, so that calls to agg(...) can be chained
+     */
+    GroupBy* agg(AggOp op, size_t value_col);
+
+    /**
+     * Sets the ThreadPool that the groups are aggregated on. The default is the ThreadPool of the
+     * DataFrame (see DataFrame::set_thread_pool(...)).
+     * 
+     * NOTE: The GroupBy does not take ownership of the ThreadPool.
+     * 
+     * @param pool - The ThreadPool to aggregate on, or nullptr to aggregate on the calling thread
+     */
+    void set_thread_pool(ThreadPool* pool);
+
+    /**
+     * Groups the rows and computes every aggregate.
+     * 
+     * @return A new DataFrame with one row per group, so care should be taken to delete it
+     */
+    DataFrame* result();
+
+    protected:
+    /* The DataFrame being grouped */
+    DataFrame* df_;
+
+    /* The numbered columns to group by */
+    size_t* key_cols_;
+
+    /* The number of columns inside of key_cols_ */
+    size_t num_keys_;
+
+    /* The aggregate of each agg(...) call */
+    AggOp* ops_;
+
+    /* The column of each agg(...) call */
+    size_t* value_cols_;
+
+    /* The number of agg(...) calls */
+    size_t num_aggs_;
+
+    /* The number of entries ops_ and value_cols_ can hold before they must grow */
+    size_t aggs_capacity_;
+
+    /* The ThreadPool the groups are aggregated on, nullptr for the calling thread */
+    ThreadPool* pool_;
+};
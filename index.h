@@ -0,0 +1,179 @@
+#pragma once
+
+#include "string.h"
+#include "object.h"
+#include "column.h"
+
+/* The kinds of ColumnIndex */
+enum IndexKind {
+    SORTED_INDEX,
+    HASH_INDEX
+};
+
+/**
+ * A secondary index on one Column, used to find the rows holding a value without scanning the
+ * whole Column. It is attached to a column of a DataFrame with DataFrame::create_index(...), and
+ * is then used by the query(...) functions on that column.
+ * 
+ * The kinds of ColumnIndex are:
+ *      SORTED_INDEX - The row indices of the Column sorted by value (ties in row order). Values
+ *                     are found by binary search, and lookup_range(...) is supported.
+ *      HASH_INDEX   - An open-addressing hash table from each distinct value to the increasing
+ *                     chain of the rows holding it. Values are found in O(1), and an appended
+ *                     row is linked onto the end of its chain in O(1).
+ * 
+ * Rows are rows of the Column, which are the physical rows of its DataFrame (see the DELETION
+ * section of dataframe.h). Deleted rows are still found until compact(), and the DataFrame
+ * clears them from the result. Missing cells (see the MISSING section of column.h) are never
+ * indexed, by the build or by append(...), so lookup(0) never finds the rows whose missing cell
+ * holds the default value, and an indexed query(...) gives the same rows as a scan.
+ * 
+ * Rows added to the end of the Column are given to append(...) by the Column (see
+ * Column::set_index(...)), so appending never rebuilds the ColumnIndex: a HASH_INDEX links the
+ * row into its chain, and a SORTED_INDEX keeps appended rows in a pending tail that is sorted and
+ * merged into the sorted rows the next time it is used (O(n + t log t) for t appended rows). Any
+ * other change to the cells of the Column (through set(...), remove_row(...), a row added in the
+ * middle, etc.) marks the ColumnIndex as stale, and it is rebuilt the next time it is used.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class ColumnIndex : public Object {
+    public:
+    /**
+     * Builds a ColumnIndex on a Column.
+     * 
+     * NOTE: If the Column is a BoolColumn, then an "error" will be thrown, as its packed words
+     * are already faster to scan.
+     * 
+     * @param column - The Column to be indexed, which is NOT owned by the ColumnIndex
+     * @param kind - SORTED_INDEX or HASH_INDEX
+     */
+    ColumnIndex(Column* column, IndexKind kind);
+
+    /* Deconstructs the ColumnIndex, but NOT its Column */
+    ~ColumnIndex();
+
+    /**
+     * Gets the kind of the ColumnIndex.
+     * 
+     * @return SORTED_INDEX or HASH_INDEX
+     */
+    IndexKind get_kind();
+
+    /**
+     * Gets the Column the ColumnIndex is built on.
+     * 
+     * @return The indexed Column
+     */
+    Column* get_column();
+
+    /**
+     * Marks the ColumnIndex as stale, so that it is rebuilt the next time it is used. This is
+     * called by the indexed Column whenever its cells change.
+     */
+    void invalidate();
+
+    /**
+     * Adds the row just appended to the end of the Column to the ColumnIndex, without rebuilding
+     * it. This is called by the indexed Column for every row added past its last row. A stale
+     * ColumnIndex ignores it, as the row is found when it is rebuilt, and a row whose cell is
+     * missing is skipped. If the cell is later set to a value, the Column calls invalidate().
+     * 
+     * NOTE: If the row is not the last row of the Column, then an "error" will be thrown.
+     * 
+     * @param row - The row of the Column that was appended
+     */
+    void append(size_t row);
+
+    /**
+     * Finds every row of an IntColumn holding int_value.
+     * 
+     * NOTE: If the Column is not an IntColumn, then an "error" will be thrown.
+     * 
+     * @param int_value - The int to be found
+     * @param num_rows - Where the number of rows found is written
+     * @return A new array of the rows found in increasing order, so care should be taken to
+     * delete it
+     */
+    size_t* lookup(int int_value, size_t* num_rows);
+
+    /**
+     * Finds every row of a FloatColumn holding float_value, comparing with IEEE == exactly like
+     * a scan (see FloatColumn::match(...)). Keys are normalised when the ColumnIndex is built and
+     * appended to, and float_value is normalised the same way: -0.0 is keyed as 0.0, so either
+     * finds both, and a NaN cell is never indexed, so lookup(NaN) finds no rows.
+     * 
+     * NOTE: If the Column is not a FloatColumn, then an "error" will be thrown.
+     * 
+     * @param float_value - The float to be found
+     * @param num_rows - Where the number of rows found is written
+     * @return A new array of the rows found in increasing order, so care should be taken to
+     * delete it
+     */
+    size_t* lookup(float float_value, size_t* num_rows);
+
+    /**
+     * Finds every row of a StringColumn holding string_value.
+     * 
+     * NOTE: If the Column is not a StringColumn, then an "error" will be thrown.
+     * 
+     * @param string_value - The String to be found
+     * @param num_rows - Where the number of rows found is written
+     * @return A new array of the rows found in increasing order, so care should be taken to
+     * delete it
+     */
+    size_t* lookup(String* string_value, size_t* num_rows);
+
+    /**
+     * Finds every row of an IntColumn holding a value between low and high (inclusive).
+     * 
+     * NOTE: If the Column is not an IntColumn, or the ColumnIndex is not a SORTED_INDEX, then an
+     * "error" will be thrown.
+     * 
+     * @param low - The smallest int to be found
+     * @param high - The largest int to be found
+     * @param num_rows - Where the number of rows found is written
+     * @return A new array of the rows found in increasing order, so care should be taken to
+     * delete it
+     */
+    size_t* lookup_range(int low, int high, size_t* num_rows);
+
+    protected:
+    /* The indexed Column */
+    Column* column_;
+
+    /* SORTED_INDEX or HASH_INDEX */
+    IndexKind kind_;
+
+    /* Whether the ColumnIndex must be rebuilt before it is next used */
+    bool stale_;
+
+    /* The number of rows of the Column that are inside of the ColumnIndex */
+    size_t num_rows_;
+
+    /* The number of rows that rows_ (SORTED_INDEX) or next_ (HASH_INDEX) can hold before growing */
+    size_t row_capacity_;
+
+    /* SORTED_INDEX: the rows sorted by value, and then the pending tail of appended rows */
+    size_t* rows_;
+
+    /* SORTED_INDEX: the number of rows at the start of rows_ that are sorted */
+    size_t num_sorted_;
+
+    /* HASH_INDEX: for each row, 1 + the next row of its chain (0 at the end of the chain) */
+    size_t* next_;
+
+    /* HASH_INDEX: for each slot, 1 + the first row of its chain (0 if the slot is empty) */
+    size_t* heads_;
+
+    /* HASH_INDEX: for each slot, the last row of its chain, where appended rows are linked */
+    size_t* tails_;
+
+    /* HASH_INDEX: the number of slots, always a power of 2, doubled past a load of one half */
+    size_t slot_capacity_;
+
+    /* HASH_INDEX: the number of slots holding a chain */
+    size_t num_slots_used_;
+};
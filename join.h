@@ -0,0 +1,141 @@
+#pragma once
+
+#include "object.h"
+#include "threadpool.h"
+#include "dataframe.h"
+
+/* The algorithms that a Join can be run with */
+enum JoinStrategy {
+    AUTO_JOIN,
+    HASH_JOIN,
+    RADIX_JOIN,
+    SORT_MERGE_JOIN
+};
+
+/**
+ * Combines the rows of two DataFrames whose key columns are equal.
+ * Example:
+ *      // Every row of facts, with the columns of the row of dims whose column 0 matches its
+ *      // column 3
+ *      Join* join = new Join(facts, dims, LEFT_JOIN);
+ *      DataFrame* enriched = join->on(3, 0)->result();
+ * 
+ * The result DataFrame has every Column of the left DataFrame, followed by every Column of the
+ * right DataFrame except its key columns (with the same types and headers). An INNER_JOIN has one
+ * row for each pair of left and right rows with equal keys. A LEFT_JOIN also keeps each left row
+ * that matched no right row, with missing cells (see the MISSING section of column.h) in the
+ * right Columns. A row whose key is missing never matches any row, not even another row with a
+ * missing key, so it is dropped by an INNER_JOIN and kept unmatched by a LEFT_JOIN. Keys are
+ * checked against the validity words before they are hashed, partitioned or sorted.
+ * 
+ * The strategies are:
+ *      HASH_JOIN       - Builds an open-addressing hash table on the keys of the smaller
+ *                        DataFrame, then probes it with each row of the larger one.
+ *      RADIX_JOIN      - Splits both DataFrames into 2^k partitions by the low bits of the key
+ *                        hashes first, so that the hash table of each partition fits in cache,
+ *                        then hash joins each pair of partitions (as Tasks on the ThreadPool).
+ *      SORT_MERGE_JOIN - Sorts a permutation of the rows of each DataFrame by key (see
+ *                        DataFrame::sort_permutation(...)), then merges the two in one pass.
+ *                        Dictionary-encoded StringColumn keys are sorted by the ranks of their
+ *                        own dictionary, which agree with String::cmp(...), and the merge
+ *                        compares the Strings of the two sides (never their codes) once per
+ *                        run of equal keys, since the two dictionaries hand out different codes.
+ *      AUTO_JOIN       - HASH_JOIN if the smaller DataFrame has at most HASH_JOIN_ROWS rows,
+ *                        RADIX_JOIN if it has at most RADIX_JOIN_ROWS rows, and SORT_MERGE_JOIN
+ *                        otherwise. This is the default.
+ * Every strategy first finds the pairs of matching rows, and then builds each result Column with
+ * a single Column::gather(...), never with set(...) on each cell. gather(...) takes physical rows
+ * (see the DELETION section of dataframe.h), so deleted rows never join: HASH_JOIN and RADIX_JOIN
+ * skip the tombstoned rows as they scan, and SORT_MERGE_JOIN turns the logical rows returned by
+ * sort_permutation(...) into physical rows before gathering, through a table of the physical row
+ * of each logical row built in one pass over the tombstones (the same rows as physical_row(...)).
+ * Rows of the result follow the order of the left DataFrame (then the right DataFrame) for
+ * HASH_JOIN and RADIX_JOIN, and the order of the keys for SORT_MERGE_JOIN.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Join : public Object {
+    public:
+    /* The most rows the smaller DataFrame can have for AUTO_JOIN to choose HASH_JOIN */
+    static const size_t HASH_JOIN_ROWS = 64 * 1024;
+
+    /* The most rows the smaller DataFrame can have for AUTO_JOIN to choose RADIX_JOIN */
+    static const size_t RADIX_JOIN_ROWS = 64 * 1024 * 1024;
+
+    /**
+     * Constructs a Join of two DataFrames with no key columns yet.
+     * 
+     * @param left - The left DataFrame, which is NOT owned by the Join
+     * @param right - The right DataFrame, which is NOT owned by the Join
+     * @param type - INNER_JOIN or LEFT_JOIN
+     */
+    Join(DataFrame* left, DataFrame* right, JoinType type);
+
+    /* Deconstructs the Join, but NOT its DataFrames */
+    ~Join();
+
+    /**
+     * Adds a pair of key columns that must be equal for two rows to match. Rows only match when
+     * every pair of key columns is equal.
+     * 
+     * NOTE: If either column is out of bounds, or the two Columns are not the same type, then an
+     * "error" will be thrown.
+     * 
+     * @param left_col - The numbered column of the left DataFrame (starting from 0)
+     * @param right_col - The numbered column of the right DataFrame (starting from 0)
+     * @return This Join, so that calls to on(...) can be chained
+     */
+    Join* on(size_t left_col, size_t right_col);
+
+    /**
+     * Sets the algorithm the Join is run with. The default is AUTO_JOIN.
+     * 
+     * @param strategy - The JoinStrategy to run with
+     */
+    void set_strategy(JoinStrategy strategy);
+
+    /**
+     * Sets the ThreadPool that the partitions of a RADIX_JOIN are joined on. The default is the
+     * ThreadPool of the left DataFrame.
+     * 
+     * NOTE: The Join does not take ownership of the ThreadPool.
+     * 
+     * @param pool - The ThreadPool to join on, or nullptr to join on the calling thread
+     */
+    void set_thread_pool(ThreadPool* pool);
+
+    /**
+     * Joins the two DataFrames.
+     * 
+     * NOTE: If no key columns have been added with on(...), then an "error" will be thrown.
+     * 
+     * @return A new DataFrame with the joined rows, so care should be taken to delete it
+     */
+    DataFrame* result();
+
+    protected:
+    /* The DataFrames being joined */
+    DataFrame* left_;
+    DataFrame* right_;
+
+    /* INNER_JOIN or LEFT_JOIN */
+    JoinType type_;
+
+    /* The algorithm the Join is run with */
+    JoinStrategy strategy_;
+
+    /* The key columns of each DataFrame, one pair per on(...) call */
+    size_t* left_keys_;
+    size_t* right_keys_;
+
+    /* The number of on(...) calls */
+    size_t num_keys_;
+
+    /* The number of entries left_keys_ and right_keys_ can hold before they must grow */
+    size_t keys_capacity_;
+
+    /* The ThreadPool the partitions are joined on, nullptr for the calling thread */
+    ThreadPool* pool_;
+};
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * Arithmetic, cast and reduction kernels over a contiguous run of cells (normally one chunk of a
+ * Column). These are the kernels behind the apply(...), map(...), to_*() and reduction functions
+ * of IntColumn and FloatColumn.
+ * 
+ * Like the scans in scan.h, each kernel has a scalar, an SSE2 and an AVX2 version, and the
+ * version chosen by get_scan_path() is used.
+ * 
+ * Kernels that change or reduce cells take the validity words of the run (see the MISSING section
+ * of column.h), where bit i is set if cell i holds a value, or nullptr if every cell is valid. A
+ * missing cell is never changed, so it keeps holding the default value of its Column, and it is
+ * never counted by a reduction. The validity words are applied as a blend mask 64 cells at a
+ * time, so runs with no missing cells cost nothing extra.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+/**
+ * The arithmetic that can be applied to cells, as in (cell OP value). On ints, ADD_ARITH,
+ * SUB_ARITH and MUL_ARITH wrap around modulo 2^32 (they are computed on the cells as unsigned
+ * ints), so they never overflow. DIV_ARITH rounds toward 0, and INT_MIN DIV_ARITH -1 is defined
+ * as INT_MIN (the wrapped result) rather than trapping.
+ */
+enum ArithOp {
+    ADD_ARITH,
+    SUB_ARITH,
+    MUL_ARITH,
+    DIV_ARITH
+};
+
+/**
+ * Applies an ArithOp with the same int to every valid cell, in place, wrapping as described for
+ * ArithOp.
+ * 
+ * NOTE: If op is DIV_ARITH and int_value is 0, then an "error" will be thrown. DIV_ARITH rounds
+ * toward 0.
+ * 
+ * @param cells - The first cell to be changed
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to change
+ * @param op - The arithmetic that is applied, as in (cell op int_value)
+ * @param int_value - The int that every cell is combined with
+ */
+void apply_kernel(int* cells, const uint64_t* valid, size_t length, ArithOp op, int int_value);
+
+/**
+ * Applies an ArithOp with the same float to every valid cell, in place.
+ * 
+ * @param cells - The first cell to be changed
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to change
+ * @param op - The arithmetic that is applied, as in (cell op float_value)
+ * @param float_value - The float that every cell is combined with
+ */
+void apply_kernel(float* cells, const uint64_t* valid, size_t length, ArithOp op,
+    float float_value);
+
+/**
+ * Applies an ArithOp between each valid cell and the cell at the same position of another run,
+ * in place, wrapping as described for ArithOp. valid should already be the AND of the validity
+ * words of both runs, so a cell is only changed if both it and the other cell hold a value.
+ * 
+ * NOTE: If op is DIV_ARITH and any valid cell of others is 0, then an "error" will be thrown.
+ * Missing cells of others (which hold 0) are never divided by.
+ * 
+ * @param cells - The first cell to be changed
+ * @param others - The first cell to combine with
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to change
+ * @param op - The arithmetic that is applied, as in (cell op other)
+ */
+void apply_kernel(int* cells, const int* others, const uint64_t* valid, size_t length,
+    ArithOp op);
+
+/**
+ * Applies an ArithOp between each valid cell and the cell at the same position of another run,
+ * in place. valid should already be the AND of the validity words of both runs.
+ * 
+ * @param cells - The first cell to be changed
+ * @param others - The first cell to combine with
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to change
+ * @param op - The arithmetic that is applied, as in (cell op other)
+ */
+void apply_kernel(float* cells, const float* others, const uint64_t* valid, size_t length,
+    ArithOp op);
+
+/**
+ * Converts ints into floats, rounding to the nearest float (every int fits the range of a float,
+ * so this is always defined). A missing cell is written as 0.0.
+ * 
+ * @param cells - The first cell to be converted
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to convert
+ * @param out - Where the length floats are written
+ */
+void cast_kernel(const int* cells, const uint64_t* valid, size_t length, float* out);
+
+/**
+ * Converts floats into ints, rounding toward 0 and saturating: a float at or past INT_MAX gives
+ * INT_MAX, a float at or below INT_MIN gives INT_MIN (including the infinities), and a NaN gives
+ * a missing cell holding 0. Every version of the kernel gives the same ints: the SIMD versions
+ * clamp each float into range before converting it, and clear the NaN cells with a blend, so
+ * the INT_MIN the hardware gives for a NaN or out of range float never comes out.
+ * 
+ * @param cells - The first cell to be converted
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to convert
+ * @param out - Where the length ints are written (0 for every missing or NaN cell)
+ * @param out_valid - Where the (length + 63) / 64 validity words of the ints are written: the
+ * validity words of the cells, with the bit of every NaN cell cleared
+ * @return The number of NaN cells that became missing
+ */
+size_t cast_kernel(const float* cells, const uint64_t* valid, size_t length, int* out,
+    uint64_t* out_valid);
+
+/**
+ * Sums the valid cells into a 64-bit integer, so the sum of a chunk can never overflow.
+ * 
+ * @param cells - The first cell to be summed
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to sum
+ * @return The sum of the valid cells
+ */
+int64_t sum_kernel(const int* cells, const uint64_t* valid, size_t length);
+
+/**
+ * Sums the valid cells into a double.
+ * 
+ * @param cells - The first cell to be summed
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to sum
+ * @return The sum of the valid cells
+ */
+double sum_kernel(const float* cells, const uint64_t* valid, size_t length);
+
+/**
+ * Finds the count, mean and M2 (the sum of the squared distances from the mean) of the valid
+ * cells, in two passes over the run: the first finds the mean, and the second sums the squared
+ * distances from it, so no precision is lost to the size of the mean. The moments of separate
+ * runs are combined with merge_moments(...).
+ * 
+ * @param cells - The first cell to be reduced
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to reduce
+ * @param mean - Where the mean of the valid cells is written (0 if there are none)
+ * @param m2 - Where the M2 of the valid cells is written (0 if there are none)
+ * @return The number of valid cells
+ */
+size_t moments_kernel(const int* cells, const uint64_t* valid, size_t length, double* mean,
+    double* m2);
+
+/**
+ * Finds the count, mean and M2 of the valid cells, the same as the int version.
+ * 
+ * @param cells - The first cell to be reduced
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to reduce
+ * @param mean - Where the mean of the valid cells is written (0 if there are none)
+ * @param m2 - Where the M2 of the valid cells is written (0 if there are none)
+ * @return The number of valid cells
+ */
+size_t moments_kernel(const float* cells, const uint64_t* valid, size_t length, double* mean,
+    double* m2);
+
+/**
+ * Merges the moments of one run of cells into the moments of another with Chan's formula, where
+ * delta is the difference of the two means:
+ *      mean = mean + delta * other_count / (count + other_count)
+ *      m2 = m2 + other_m2 + delta^2 * count * other_count / (count + other_count)
+ * The variance of every merged run is then m2 / count.
+ * 
+ * @param count - The number of cells of the first run, which is updated
+ * @param mean - The mean of the first run, which is updated
+ * @param m2 - The M2 of the first run, which is updated
+ * @param other_count - The number of cells of the run merged in
+ * @param other_mean - The mean of the run merged in
+ * @param other_m2 - The M2 of the run merged in
+ */
+void merge_moments(size_t* count, double* mean, double* m2, size_t other_count,
+    double other_mean, double other_m2);
+
+/**
+ * Finds the smallest and largest valid cell.
+ * 
+ * @param cells - The first cell to be checked
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to check
+ * @param min - Where the smallest valid cell is written
+ * @param max - Where the largest valid cell is written
+ * @return True if any cell was valid, false if there were none (and nothing is written)
+ */
+bool min_max_kernel(const int* cells, const uint64_t* valid, size_t length, int* min, int* max);
+
+/**
+ * Finds the smallest and largest valid cell, skipping any NaN cells.
+ * 
+ * @param cells - The first cell to be checked
+ * @param valid - The validity words of the cells, or nullptr if every cell is valid
+ * @param length - The number of cells to check
+ * @param min - Where the smallest valid cell is written
+ * @param max - Where the largest valid cell is written
+ * @return True if any cell was valid and not NaN, false if there were none (and nothing is
+ * written)
+ */
+bool min_max_kernel(const float* cells, const uint64_t* valid, size_t length, float* min,
+    float* max);
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "string.h"
+#include "object.h"
+#include "datafile.h"
+#include "threadpool.h"
+#include "dataframe.h"
+
+/**
+ * The text formats a Loader can read (see Loader::set_format(...)).
+ * 
+ *      CSV_FORMAT - One row per line, fields split by the delimiter (see set_delimiter(...)). A
+ *                   field may be quoted with '"', in which case it may hold the delimiter, line
+ *                   breaks, and '"' itself written twice (""), and the quotes are not part of the
+ *                   field. A quoted field always fits the String type, even if it looks like a
+ *                   number, and "" is an empty String rather than a missing cell.
+ *      SOR_FORMAT - One row per line, each field written inside of < and >, as in
+ *                   <1> <"hello world"> <> <0.5>. Spaces around a field and between fields are
+ *                   ignored, a field may be quoted with '"' to keep spaces (it then fits the String
+ *                   type only), and <> is a missing cell. A row with fewer fields than the widest
+ *                   row has missing cells in its last columns. The delimiter is not used.
+ */
+enum LoaderFormat {
+    CSV_FORMAT,
+    SOR_FORMAT
+};
+
+/**
+ * Loads a large delimited text file (such as a CSV, or a schema-on-read file of <field>s) into a
+ * new DataFrame, in bulk.
+ * 
+ * The type of each column (BoolColumn, IntColumn, FloatColumn or StringColumn) is inferred from
+ * the first rows of the file. A column is the first of these types that every sampled field fits:
+ *      bool   - 0, 1, true or false
+ *      int    - an optional sign followed by digits, that fits inside of an int
+ *      float  - anything strtof(...) fully accepts
+ *      String - anything else
+ * Empty (unquoted) fields fit every type, and become missing cells of their Column (see the
+ * MISSING section of column.h), so an empty field is never mistaken for a 0, false or "" that was
+ * in the file. Quoted fields only fit the String type (see LoaderFormat).
+ * 
+ * The file is memory mapped and split into pieces of about set_chunk_bytes(...) bytes, each moved
+ * forward to start on a new line. As a quoted field may hold line breaks, the pieces first count
+ * their '"' characters in parallel, and a running total of those counts tells each piece whether
+ * it starts inside of quotes, so it is moved forward to the first line break outside of quotes.
+ * Each piece is then parsed by a Task on the ThreadPool into its own typed buffers, and the
+ * buffers of each piece are then appended straight into the chunks of the Columns in file order,
+ * so rows keep the order of the file and cells are never set one by one.
+ * 
+ * WIDENING: A field after the sampled rows may not fit the inferred type of its column (such as
+ * 2.5 in a column that was all ints inside of the sample). The piece holding it keeps parsing,
+ * and marks the column with the first type (bool, then int, then float, then String) that all of
+ * its fields of that column fit. Once every piece is parsed, each column takes the widest type any
+ * piece marked, and only the pieces whose buffers of that column were parsed as a narrower type
+ * parse that column again, so a column is widened without reading the rest of the file twice.
+ * get_type(...) gives the widened type once load() is done. A column whose type was forced with
+ * set_type(...) is never widened.
+ * 
+ * NOTE: A field that does not fit the forced type of its column makes load() throw an "error"
+ * naming the row (starting from 0, not counting the header line) and column of the field. A quote
+ * that is never closed, or a SOR_FORMAT field missing its >, also makes load() throw an "error"
+ * naming the row it starts on.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Loader : public Object {
+    public:
+    /* The default number of rows that column types are inferred from */
+    static const size_t DEFAULT_SAMPLE_ROWS = 1000;
+
+    /* The default number of bytes of the file parsed by each Task */
+    static const size_t DEFAULT_CHUNK_BYTES = 16 * 1024 * 1024;
+
+    /**
+     * Constructs a Loader for a file. Nothing is read until infer_types() or load() is called.
+     * 
+     * @param path - The path of the file to be loaded
+     */
+    Loader(const char* path);
+
+    /* Deconstructs the Loader, and unmaps its file */
+    ~Loader();
+
+    /**
+     * Sets the format of the file. The default is CSV_FORMAT.
+     * 
+     * @param format - CSV_FORMAT or SOR_FORMAT
+     */
+    void set_format(LoaderFormat format);
+
+    /**
+     * Sets the character that separates the fields of a row of a CSV_FORMAT file. The default
+     * is ','.
+     * 
+     * @param delimiter - The field separator
+     */
+    void set_delimiter(char delimiter);
+
+    /**
+     * Sets whether the first line of the file holds the headers of the columns. The default is
+     * false.
+     * 
+     * @param has_headers - True if the first line should become the headers of the Columns
+     */
+    void set_has_headers(bool has_headers);
+
+    /**
+     * Sets the number of rows that column types are inferred from. The default is
+     * DEFAULT_SAMPLE_ROWS.
+     * 
+     * @param rows - The number of rows to sample
+     */
+    void set_sample_rows(size_t rows);
+
+    /**
+     * Sets about how many bytes of the file each Task parses. The default is DEFAULT_CHUNK_BYTES.
+     * 
+     * @param bytes - The number of bytes per Task
+     */
+    void set_chunk_bytes(size_t bytes);
+
+    /**
+     * Sets the ThreadPool that pieces of the file are parsed on.
+     * 
+     * NOTE: The Loader does not take ownership of the ThreadPool.
+     * 
+     * @param pool - The ThreadPool to parse on, or nullptr to parse on the calling thread
+     */
+    void set_thread_pool(ThreadPool* pool);
+
+    /**
+     * Infers the type of each column from the sampled rows. This is done by load() if it has not
+     * been done already.
+     * 
+     * NOTE: If the file cannot be opened, then an "error" will be thrown.
+     */
+    void infer_types();
+
+    /**
+     * The number of columns found in the file by infer_types().
+     * 
+     * @return The number of fields of the widest sampled row
+     */
+    size_t ncol();
+
+    /**
+     * Gets the inferred (or forced) type of a column. Once load() is done, this is the type the
+     * column was widened to, if any field after the sampled rows did not fit (see WIDENING).
+     * 
+     * NOTE: If the column is out of bounds, then an "error" will be thrown.
+     * 
+     * @param column - The numbered column of the file (starting from 0)
+     * @return The ColumnTag of the Column that will be created for the column
+     */
+    ColumnTag get_type(size_t column);
+
+    /**
+     * Forces the type of a column instead of using the inferred one. The column is then never
+     * widened (see WIDENING).
+     * 
+     * NOTE: If the column is out of bounds, then an "error" will be thrown.
+     * 
+     * @param column - The numbered column of the file (starting from 0)
+     * @param type - The ColumnTag of the Column to be created for the column
+     */
+    void set_type(size_t column, ColumnTag type);
+
+    /**
+     * Loads every row of the file into a new DataFrame.
+     * 
+     * NOTE: If the file cannot be opened, or a field does not fit the forced type of its column,
+     * then an "error" naming the row and column of the field will be thrown.
+     * 
+     * @return A new DataFrame, so care should be taken to delete it
+     */
+    DataFrame* load();
+
+    protected:
+    /* The file being loaded */
+    MappedFile* file_;
+
+    /* The path of the file being loaded */
+    String* path_;
+
+    /* CSV_FORMAT or SOR_FORMAT */
+    LoaderFormat format_;
+
+    /* The field separator of CSV_FORMAT */
+    char delimiter_;
+
+    /* Whether the first line holds the headers */
+    bool has_headers_;
+
+    /* The number of rows that types are inferred from */
+    size_t sample_rows_;
+
+    /* About how many bytes each Task parses */
+    size_t chunk_bytes_;
+
+    /* The ThreadPool that pieces are parsed on, nullptr for the calling thread */
+    ThreadPool* pool_;
+
+    /* The type of each column, nullptr until infer_types() is called */
+    ColumnTag* types_;
+
+    /* Whether the type of each column was forced with set_type(...), so it is never widened */
+    bool* forced_;
+
+    /* The number of columns inside of types_ */
+    size_t ncol_;
+};
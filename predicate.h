@@ -0,0 +1,256 @@
+#pragma once
+
+#include <stdint.h>
+#include "string.h"
+#include "object.h"
+#include "bitmap.h"
+#include "scan.h"
+#include "dataframe.h"
+
+/* The ways that two Predicates can be combined */
+enum LogicOp {
+    AND_LOGIC,
+    OR_LOGIC
+};
+
+/**
+ * A filter on the rows of a DataFrame, made of comparisons on single columns that can be combined
+ * with AND_LOGIC and OR_LOGIC across any number of columns.
+ * Example:
+ *      // (col 0 >= 10 AND col 0 < 20) OR col 2 == "red"
+ *      Predicate* p = new Predicate(
+ *          new Predicate(new Predicate(0, GREATER_EQUAL_COMPARE, 10), AND_LOGIC,
+ *              new Predicate(0, LESS_COMPARE, 20)),
+ *          OR_LOGIC,
+ *          new Predicate(2, EQUAL_COMPARE, new String("red")));
+ *      DataFrame* sub_df = df->query(p);
+ * 
+ * A Predicate is only a description of the filter, and holds no rows. It is compiled into a
+ * FusedScan by DataFrame::filter(...) and DataFrame::query(Predicate*).
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Predicate : public Object {
+    public:
+    /**
+     * Constructs a Predicate that compares the cells of an IntColumn to an int.
+     * 
+     * @param col - The numbered column of the DataFrame (starting from 0)
+     * @param op - The comparison that is checked, as in (cell op int_value)
+     * @param int_value - The int that every cell will be compared to
+     */
+    Predicate(size_t col, CompareOp op, int int_value);
+
+    /**
+     * Constructs a Predicate that compares the cells of a FloatColumn to a float.
+     * 
+     * @param col - The numbered column of the DataFrame (starting from 0)
+     * @param op - The comparison that is checked, as in (cell op float_value)
+     * @param float_value - The float that every cell will be compared to
+     */
+    Predicate(size_t col, CompareOp op, float float_value);
+
+    /**
+     * Constructs a Predicate that compares the cells of a BoolColumn to a Boolean.
+     * 
+     * NOTE: If op is not EQUAL_COMPARE or NOT_EQUAL_COMPARE, then an "error" will be thrown.
+     * 
+     * @param col - The numbered column of the DataFrame (starting from 0)
+     * @param op - The comparison that is checked, as in (cell op bool_value)
+     * @param bool_value - The Boolean that every cell will be compared to
+     */
+    Predicate(size_t col, CompareOp op, bool bool_value);
+
+    /**
+     * Constructs a Predicate that compares the cells of a StringColumn to a String, with
+     * String::cmp(...) for ordering and String::equals(...) for equality.
+     * 
+     * NOTE: The Predicate takes ownership of string_value.
+     * 
+     * @param col - The numbered column of the DataFrame (starting from 0)
+     * @param op - The comparison that is checked, as in (cell op string_value)
+     * @param string_value - The String that every cell will be compared to
+     */
+    Predicate(size_t col, CompareOp op, String* string_value);
+
+    /**
+     * Constructs a Predicate that matches the cells of an IntColumn between two ints (inclusive).
+     * 
+     * @param col - The numbered column of the DataFrame (starting from 0)
+     * @param low - The smallest int that will match
+     * @param high - The largest int that will match
+     */
+    Predicate(size_t col, int low, int high);
+
+    /**
+     * Constructs a Predicate that matches the cells of a FloatColumn between two floats
+     * (inclusive).
+     * 
+     * @param col - The numbered column of the DataFrame (starting from 0)
+     * @param low - The smallest float that will match
+     * @param high - The largest float that will match
+     */
+    Predicate(size_t col, float low, float high);
+
+    /**
+     * Constructs a Predicate that combines two other Predicates.
+     * 
+     * NOTE: The Predicate takes ownership of left and right.
+     * 
+     * @param left - The first Predicate to be combined
+     * @param op - AND_LOGIC to match rows that match both Predicates, OR_LOGIC to match rows that
+     *      match either
+     * @param right - The second Predicate to be combined
+     */
+    Predicate(Predicate* left, LogicOp op, Predicate* right);
+
+    /* Deconstructs the Predicate, and every Predicate and String that it owns */
+    ~Predicate();
+
+    /**
+     * Determines if another object is equal to this one.
+     * 
+     * @param obj - The Object that will be compared 
+     * @return For a Predicate to equal another Predicate, they must compare the same columns to
+     * the same values, combined in the same way.
+     */
+    bool equals(Object* const obj);
+
+    /**
+     * Checks that every column of the Predicate is inside of a DataFrame, and that each column is
+     * the type of Column that its comparison needs.
+     * 
+     * @param df - The DataFrame that the Predicate will be run on
+     * @return True if the Predicate can be run on df, false otherwise
+     */
+    bool check(DataFrame* df);
+
+    /**
+     * Checks that every column of the Predicate is inside of a Snapshot, and that each column is
+     * the type of Column that its comparison needs, using only the types recorded in the
+     * Snapshot (see Snapshot::get_type(...)).
+     * 
+     * @param snapshot - The Snapshot that the Predicate will be run on
+     * @return True if the Predicate can be run on snapshot, false otherwise
+     */
+    bool check(Snapshot* snapshot);
+
+    protected:
+    friend class FusedScan;
+
+    /* The kinds of Predicate nodes */
+    enum Kind { INT_COMPARE, FLOAT_COMPARE, BOOL_COMPARE, STRING_COMPARE, INT_BETWEEN,
+        FLOAT_BETWEEN, COMBINE };
+
+    /* The kind of this Predicate node */
+    Kind kind_;
+
+    /* The column that is compared, unused by COMBINE */
+    size_t col_;
+
+    /* The comparison used by the *_COMPARE kinds */
+    CompareOp compare_;
+
+    /* The way left_ and right_ are combined, used by COMBINE */
+    LogicOp logic_;
+
+    /* The value compared to, or the low end of a *_BETWEEN */
+    int int_value_;
+    float float_value_;
+    bool bool_value_;
+    String* string_value_;
+
+    /* The high end of a *_BETWEEN */
+    int int_high_;
+    float float_high_;
+
+    /* The Predicates combined by COMBINE, nullptr otherwise */
+    Predicate* left_;
+    Predicate* right_;
+};
+
+/**
+ * A Predicate compiled for a specific DataFrame, so that every column it involves is filtered in
+ * a single fused pass.
+ * 
+ * Compiling checks each column's type once, and flattens the Predicate into a list of steps
+ * (one scan_compare(...) or scan_between(...) per comparison, and one word-wide AND or OR per
+ * combination). The steps are then run one chunk at a time: every comparison writes into a small
+ * per-chunk scratch of words that stays in cache, and the combinations are applied to those words
+ * before the next chunk is started. Only the final Bitmap is ever written to memory, and no
+ * intermediate DataFrames are created.
+ * 
+ * Equality on a dictionary-encoded StringColumn compares codes. Any other String comparison
+ * first finds the matching dictionary codes once and then checks codes, or falls back to
+ * String::cmp(...) on each cell if the StringColumn is not encoded.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class FusedScan : public Object {
+    public:
+    /**
+     * Compiles a Predicate for a DataFrame.
+     * 
+     * NOTE: If predicate->check(df) is false, then an "error" will be thrown.
+     * 
+     * @param predicate - The Predicate to compile, which is NOT owned by the FusedScan
+     * @param df - The DataFrame the Predicate will be run on
+     */
+    FusedScan(Predicate* predicate, DataFrame* df);
+
+    /**
+     * Compiles a Predicate for a Snapshot. The steps read the chunks of the Snapshot's Version
+     * instead of the live Columns, so the FusedScan can run while the writer changes the
+     * DataFrame.
+     * 
+     * NOTE: If predicate->check(snapshot) is false, then an "error" will be thrown.
+     * 
+     * @param predicate - The Predicate to compile, which is NOT owned by the FusedScan
+     * @param snapshot - The Snapshot the Predicate will be run on, which must outlive the
+     * FusedScan
+     */
+    FusedScan(Predicate* predicate, Snapshot* snapshot);
+
+    /* Deconstructs the FusedScan */
+    ~FusedScan();
+
+    /**
+     * Runs the FusedScan over a range of physical rows of the DataFrame (see the DELETION section
+     * of dataframe.h), so that the range always starts on a chunk. Deleted rows are cleared.
+     * 
+     * NOTE: If start is not a multiple of Column::CHUNK_SIZE, or end is past
+     * nrow() + num_deleted(), then an "error" will be thrown.
+     * 
+     * @param start - The first physical row to be filtered
+     * @param end - The physical row after the last row to be filtered
+     * @param out - The Bitmap that the matches of the rows are written to, at the same bits as
+     * their rows
+     */
+    void run(size_t start, size_t end, Bitmap* out);
+
+    /**
+     * Runs the FusedScan over every row of the DataFrame, on the ThreadPool of the DataFrame if
+     * it has one.
+     * 
+     * @return A new Bitmap of nrow() + num_deleted() bits, where bit r is set if physical row r
+     * matched and is not deleted
+     */
+    Bitmap* run();
+
+    protected:
+    /* The DataFrame the FusedScan runs on, nullptr if it runs on a Snapshot */
+    DataFrame* df_;
+
+    /* The Snapshot the FusedScan runs on, nullptr if it runs on a DataFrame */
+    Snapshot* snapshot_;
+
+    /* The flattened steps of the Predicate, in the order they are run */
+    class FusedStep** steps_;
+
+    /* The number of steps inside of steps_ */
+    size_t num_steps_;
+};
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "string.h"
+#include "object.h"
+#include "dataframe.h"
+
+/**
+ * A lightweight, read-only view of one row of a DataFrame, handed to a Rower by
+ * DataFrame::map(...) and DataFrame::pmap(...). A Row does not copy or allocate anything, it only
+ * holds the DataFrame and a row index, and its getters read straight from the chunks of the
+ * Columns. The same Row is moved from row to row with set_index(...), so visiting every row of a
+ * DataFrame allocates nothing.
+ * 
+ * CAUTION: A Row is only valid during the call to Rower::accept(...) it is given to, and must not
+ * be kept afterwards.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Row : public Object {
+    public:
+    /**
+     * Constructs a Row at the first row of a DataFrame.
+     * 
+     * @param df - The DataFrame the Row reads from, which is NOT owned by the Row
+     */
+    Row(DataFrame* df);
+
+    /* Deconstructs the Row, but NOT its DataFrame */
+    ~Row();
+
+    /**
+     * Moves the Row to another row of its DataFrame.
+     * 
+     * NOTE: If row is out of bounds, then an "error" will be thrown.
+     * 
+     * @param row - The numbered row of the DataFrame (starting from 0)
+     */
+    void set_index(size_t row);
+
+    /**
+     * Gets the row of the DataFrame that the Row is at.
+     * 
+     * @return The numbered row of the DataFrame (starting from 0)
+     */
+    size_t get_index();
+
+    /**
+     * The number of cells in the Row.
+     * 
+     * @return The number of columns of the DataFrame
+     */
+    size_t width();
+
+    /**
+     * Gets a String from a cell of the Row.
+     * 
+     * NOTE: If the column is out of bounds, or is NOT a StringColumn, then an "error" will be
+     * thrown.
+     * 
+     * @param column - The numbered column of the DataFrame (starting from 0)
+     * @return The String inside of the cell, which is NOT owned by the caller
+     */
+    String* get_string(size_t column);
+
+    /**
+     * Gets a Boolean from a cell of the Row.
+     * 
+     * NOTE: If the column is out of bounds, or is NOT a BoolColumn, then an "error" will be
+     * thrown.
+     * 
+     * @param column - The numbered column of the DataFrame (starting from 0)
+     * @return The Boolean inside of the cell
+     */
+    bool get_bool(size_t column);
+
+    /**
+     * Gets an int from a cell of the Row.
+     * 
+     * NOTE: If the column is out of bounds, or is NOT an IntColumn, then an "error" will be
+     * thrown.
+     * 
+     * @param column - The numbered column of the DataFrame (starting from 0)
+     * @return The int inside of the cell
+     */
+    int get_int(size_t column);
+
+    /**
+     * Gets a float from a cell of the Row.
+     * 
+     * NOTE: If the column is out of bounds, or is NOT a FloatColumn, then an "error" will be
+     * thrown.
+     * 
+     * @param column - The numbered column of the DataFrame (starting from 0)
+     * @return The float inside of the cell
+     */
+    float get_float(size_t column);
+
+    /**
+     * Finds whether a cell of the Row is missing (see DataFrame::is_missing(...)).
+     * 
+     * NOTE: If the column is out of bounds, then an "error" will be thrown.
+     * 
+     * @param column - The numbered column of the DataFrame (starting from 0)
+     * @return True if the cell has no value, false otherwise
+     */
+    bool is_missing(size_t column);
+
+    protected:
+    /* The DataFrame the Row reads from */
+    DataFrame* df_;
+
+    /* The row of the DataFrame the Row is at */
+    size_t row_;
+};
+
+/**
+ * A visitor that is given every row of a DataFrame by DataFrame::map(...) or
+ * DataFrame::pmap(...). Subclasses keep whatever they compute (such as a count or a sum) as their
+ * own fields.
+ * 
+ * For pmap(...), the Rower is cloned once for each contiguous range of rows (one range for each
+ * thread), each clone visits the rows of its range in order, and the clones are then joined back
+ * into the original Rower with join_delete(...) in the order of their ranges. So join_delete(...)
+ * may depend on order (such as appending the rows a clone kept), as the rows of a clone always
+ * come right after the rows already joined.
+ * Example:
+ *      class SumRower : public Rower {
+ *          public:
+ *          long total = 0;
+ *          bool accept(Row& r) { total += r.get_int(0); return true; }
+ *          Rower* clone() { return new SumRower(); }
+ *          void join_delete(Rower* other) { total += ((SumRower*)other)->total; delete other; }
+ *      };
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Rower : public Object {
+    public:
+    /**
+     * Visits one row of a DataFrame.
+     * 
+     * NOTE: The default behavior of this function will be to throw an error, it must be
+     * overriden by subclasses.
+     * 
+     * @param r - The Row being visited, only valid during this call
+     * @return True if the row was used, false otherwise. This is not used by map(...) or
+     * pmap(...), but is kept for subclasses that filter rows.
+     */
+    virtual bool accept(Row& r);
+
+    /**
+     * Creates a new Rower of the same type, with empty results, for another thread of pmap(...)
+     * to visit rows with.
+     * 
+     * NOTE: The default behavior of this function will be to throw an error, it must be
+     * overriden by subclasses that are used with pmap(...).
+     * 
+     * @return A new Rower, which will be given back to join_delete(...)
+     */
+    virtual Rower* clone();
+
+    /**
+     * Adds the results of a clone (made by clone()) into this Rower, and then deletes the clone.
+     * Clones are joined in the order of the rows they visited.
+     * 
+     * NOTE: The default behavior of this function will be to throw an error, it must be
+     * overriden by subclasses that are used with pmap(...).
+     * 
+     * @param other - The clone to be joined and deleted
+     */
+    virtual void join_delete(Rower* other);
+};
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * Equality scans that compare a contiguous run of cells (normally one chunk of a Column) against
+ * a single value, writing the matches into packed 64-bit words where bit i is set if cell i
+ * matched. These are the kernels behind the match(...) functions of IntColumn, FloatColumn and
+ * a dictionary-encoded StringColumn.
+ * 
+ * Each scan has a scalar, an SSE2 and an AVX2 version. The fastest version that the CPU
+ * supports is detected (with cpuid) the first time a scan is run, and used from then on.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+/* The versions of the scans that can be chosen from */
+enum ScanPath {
+    SCALAR_SCAN,
+    SSE2_SCAN,
+    AVX2_SCAN
+};
+
+/* The comparisons that a cell can be checked with, as in (cell OP value) */
+enum CompareOp {
+    EQUAL_COMPARE,
+    NOT_EQUAL_COMPARE,
+    LESS_COMPARE,
+    LESS_EQUAL_COMPARE,
+    GREATER_COMPARE,
+    GREATER_EQUAL_COMPARE
+};
+
+/**
+ * Gets the version of the scans currently in use. The first call detects the best version that
+ * the CPU supports.
+ * 
+ * @return The ScanPath used by scan_equal(...)
+ */
+ScanPath get_scan_path();
+
+/**
+ * Forces a specific version of the scans to be used, mainly for testing and benchmarking.
+ * 
+ * NOTE: If the CPU does not support the chosen ScanPath, then an "error" will be thrown.
+ * 
+ * @param path - The ScanPath to be used by scan_equal(...)
+ */
+void set_scan_path(ScanPath path);
+
+/**
+ * Compares cells against an int value.
+ * 
+ * @param cells - The first cell to be compared
+ * @param length - The number of cells to compare
+ * @param int_value - The int that every cell will be compared to
+ * @param out - The (length + 63) / 64 words that the matches are written to. Any bits past
+ * length in the last word are set to 0.
+ */
+void scan_equal(const int* cells, size_t length, int int_value, uint64_t* out);
+
+/**
+ * Compares cells against a float value.
+ * 
+ * NOTE: Cells are compared with ==, so NaN never matches and 0.0 matches -0.0.
+ * 
+ * @param cells - The first cell to be compared
+ * @param length - The number of cells to compare
+ * @param float_value - The float that every cell will be compared to
+ * @param out - The (length + 63) / 64 words that the matches are written to. Any bits past
+ * length in the last word are set to 0.
+ */
+void scan_equal(const float* cells, size_t length, float float_value, uint64_t* out);
+
+/**
+ * Compares cells against a 32-bit code, such as the codes of a dictionary-encoded StringColumn.
+ * 
+ * @param cells - The first cell to be compared
+ * @param length - The number of cells to compare
+ * @param code - The code that every cell will be compared to
+ * @param out - The (length + 63) / 64 words that the matches are written to. Any bits past
+ * length in the last word are set to 0.
+ */
+void scan_equal(const uint32_t* cells, size_t length, uint32_t code, uint64_t* out);
+
+/**
+ * Compares cells against an int value with any CompareOp.
+ * 
+ * @param cells - The first cell to be compared
+ * @param length - The number of cells to compare
+ * @param op - The comparison that is checked, as in (cell op int_value)
+ * @param int_value - The int that every cell will be compared to
+ * @param out - The (length + 63) / 64 words that the matches are written to. Any bits past
+ * length in the last word are set to 0.
+ */
+void scan_compare(const int* cells, size_t length, CompareOp op, int int_value, uint64_t* out);
+
+/**
+ * Compares cells against a float value with any CompareOp.
+ * 
+ * NOTE: Cells that are NaN only ever match NOT_EQUAL_COMPARE.
+ * 
+ * @param cells - The first cell to be compared
+ * @param length - The number of cells to compare
+ * @param op - The comparison that is checked, as in (cell op float_value)
+ * @param float_value - The float that every cell will be compared to
+ * @param out - The (length + 63) / 64 words that the matches are written to. Any bits past
+ * length in the last word are set to 0.
+ */
+void scan_compare(const float* cells, size_t length, CompareOp op, float float_value,
+    uint64_t* out);
+
+/**
+ * Finds the cells that are between two int values (inclusive), in a single pass.
+ * 
+ * @param cells - The first cell to be compared
+ * @param length - The number of cells to compare
+ * @param low - The smallest int that will match
+ * @param high - The largest int that will match
+ * @param out - The (length + 63) / 64 words that the matches are written to. Any bits past
+ * length in the last word are set to 0.
+ */
+void scan_between(const int* cells, size_t length, int low, int high, uint64_t* out);
+
+/**
+ * Finds the cells that are between two float values (inclusive), in a single pass.
+ * 
+ * @param cells - The first cell to be compared
+ * @param length - The number of cells to compare
+ * @param low - The smallest float that will match
+ * @param high - The largest float that will match
+ * @param out - The (length + 63) / 64 words that the matches are written to. Any bits past
+ * length in the last word are set to 0.
+ */
+void scan_between(const float* cells, size_t length, float low, float high, uint64_t* out);
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "string.h"
+#include "object.h"
+#include "bitmap.h"
+#include "dataframe.h"
+
+/**
+ * An immutable, consistent view of a DataFrame at the moment DataFrame::snapshot() was called.
+ * Any number of threads can read from Snapshots while one writer thread keeps changing the
+ * DataFrame, and no read ever takes a lock or sees a half-made change.
+ * 
+ * The cells of a DataFrame are held by a Version: the row count, the tombstones and their rank
+ * directory, the type and header of each Column, and a table of chunks for each Column. Each
+ * entry of a chunk table holds everything about one chunk, all shared and copied together: its
+ * cells (or its CompressedChunk, see compression.h), its validity words (see the MISSING section
+ * of column.h), and its zone map. Every chunk entry has an atomic reference count. A StringColumn
+ * entry also records the size of its StringDictionary when the Version was published. Taking a
+ * Snapshot only loads the current Version with an atomic acquire and adds a reference to it, so
+ * it costs close to nothing no matter how large the DataFrame is.
+ * 
+ * The writer changes its own working Version. The first time a chunk that is shared with a
+ * published Version is changed (its cells, validity words, zone map, or compressed form), the
+ * whole entry is copied (copy-on-write), and the chunk tables are only copied on the first change
+ * after each publish. Nothing a Version points to is ever changed in place. The one structure
+ * shared between Versions that keeps growing is the StringDictionary, which is append-only with
+ * stable storage (see dictionary.h), and a Snapshot never reads a code at or past the dictionary
+ * size recorded in its Version. A ColumnIndex belongs to the live DataFrame only, and is never
+ * used by a Snapshot. DataFrame::publish() then makes the working
+ * Version the current one with an atomic release, so every Snapshot taken afterwards sees all of
+ * the changes, and Snapshots taken before see none of them.
+ * 
+ * Reclaiming is left to the writer, as chunks go back to the DataFrame's Arena, which is not
+ * thread-safe (see arena.h). Deleting the last Snapshot of a Version (which may happen on any
+ * thread) only drops the reference count and, when it reaches 0, pushes the Version onto the
+ * DataFrame's retire list with an atomic compare-and-swap. Nothing is freed or recycled there.
+ * publish() (on the writer thread) then takes the whole retire list with one atomic exchange,
+ * and frees each retired Version and gives every chunk only it held back with
+ * Arena::recycle(...), once every reader that was inside snapshot() at the time has left it. The
+ * destructor of the DataFrame drains the retire list the same way.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Snapshot : public Object {
+    public:
+    /* Releases the Version held by the Snapshot, but NOT its DataFrame */
+    ~Snapshot();
+
+    /**
+     * Gets a String representation of a cell inside the Snapshot.
+     * 
+     * NOTE: If the choosen column is NOT an StringColumn, or row and column are out of bounds, 
+     * then an "error" should be thrown.
+     * 
+     * @param row - The numbered row of the Snapshot (starting from 0)
+     * @param column - The numbered column of the Snapshot (starting from 0)
+     * @return - A String* representation of the value inside of the cell, valid for as long as
+     * the Snapshot is
+     */
+    String* get_string(size_t row, size_t column);
+
+    /**
+     * Gets a Boolean representation of a cell inside the Snapshot.
+     * 
+     * NOTE: If the choosen column is NOT an BoolColumn, or row and column are out of bounds, 
+     * then an "error" should be thrown.
+     * 
+     * @param row - The numbered row of the Snapshot (starting from 0)
+     * @param column - The numbered column of the Snapshot (starting from 0)
+     * @return - A Boolean representation of the value inside of the cell
+     */
+    bool get_bool(size_t row, size_t column);
+
+    /**
+     * Gets an int representation of a cell inside the Snapshot.
+     * 
+     * NOTE: If the choosen column is NOT an IntColumn, or row and column are out of bounds, 
+     * then an "error" should be thrown.
+     * 
+     * @param row - The numbered row of the Snapshot (starting from 0)
+     * @param column - The numbered column of the Snapshot (starting from 0)
+     * @return - An int representation of the value inside of the cell
+     */
+    int get_int(size_t row, size_t column);
+
+    /**
+     * Gets a float representation of a cell inside the Snapshot.
+     * 
+     * NOTE: If the choosen column is NOT an FloatColumn, or row and column are out of bounds, 
+     * then an "error" should be thrown.
+     * 
+     * @param row - The numbered row of the Snapshot (starting from 0)
+     * @param column - The numbered column of the Snapshot (starting from 0)
+     * @return - A float representation of the value inside of the cell
+     */
+    float get_float(size_t row, size_t column);
+
+    /**
+     * Finds whether a cell of the Snapshot is missing (see DataFrame::is_missing(...)), as of the
+     * Version the Snapshot holds.
+     * 
+     * NOTE: If row and column are out of bounds, then an "error" will be thrown.
+     * 
+     * @param row - The numbered row of the Snapshot (starting from 0)
+     * @param column - The numbered column of the Snapshot (starting from 0)
+     * @return True if the cell has no value, false if it holds a value
+     */
+    bool is_missing(size_t row, size_t column);
+
+    /**
+     * The number of rows in the Snapshot.
+     * 
+     * @return The number of rows the DataFrame had when the Snapshot was taken.
+     */
+    size_t nrow();
+
+    /**
+     * The number of columns in the Snapshot.
+     * 
+     * @return The number of columns the DataFrame had when the Snapshot was taken.
+     */
+    size_t ncol();
+
+    /**
+     * Finds whether a column of the Snapshot is an IntColumn, FloatColumn, BoolColumn or
+     * StringColumn, from the types recorded in its Version.
+     * 
+     * NOTE: If column is out of bounds, then an "error" will be thrown.
+     * 
+     * @param column - The numbered column of the Snapshot (starting from 0)
+     * @return The ColumnTag of the column (see datafile.h)
+     */
+    ColumnTag get_type(size_t column);
+
+    /**
+     * Gets the header of a column of the Snapshot.
+     * 
+     * NOTE: If column is out of bounds, then an "error" will be thrown.
+     * 
+     * @param column - The numbered column of the Snapshot (starting from 0)
+     * @return The header of the column, or nullptr if it has none
+     */
+    String* get_header(size_t column);
+
+    /**
+     * Finds every row of the Snapshot matching a Predicate, in a single fused pass (see
+     * predicate.h). The Predicate is checked against and compiled for the Snapshot itself, so
+     * this never reads the live DataFrame while the writer changes it.
+     * 
+     * NOTE: If predicate->check(this) is false, then an "error" will be thrown.
+     * 
+     * @param predicate - The Predicate to filter with, which is NOT owned by the Snapshot
+     * @return A new Bitmap with a bit for every physical row of the Snapshot (deleted or not, as
+     * in DataFrame::filter(...)), where bit r is set if physical row r matched and is not deleted
+     */
+    Bitmap* filter(Predicate* predicate);
+
+    /**
+     * Gets a new DataFrame with a copy of the rows of the Snapshot matching a Predicate. This is
+     * filter(predicate), with the matching rows then copied out of the Snapshot's Version.
+     * 
+     * NOTE: If predicate->check(this) is false, then an "error" will be thrown.
+     * 
+     * @param predicate - The Predicate to filter with, which is NOT owned by the Snapshot
+     * @return A new DataFrame, the order of the rows will be the same as the Snapshot.
+     */
+    DataFrame* query(Predicate* predicate);
+
+    /**
+     * Creates a new DataFrame with a copy of every row of the Snapshot.
+     * 
+     * @return A new DataFrame, so care should be taken to delete it
+     */
+    DataFrame* to_dataframe();
+
+    protected:
+    friend class DataFrame;
+
+    /**
+     * Creates a Snapshot holding a reference to a Version. Only made by DataFrame::snapshot().
+     * 
+     * @param df - The DataFrame the Version belongs to
+     * @param version - The Version, whose reference is now owned by the Snapshot
+     */
+    Snapshot(DataFrame* df, class Version* version);
+
+    /* The DataFrame the Snapshot was taken from */
+    DataFrame* df_;
+
+    /* The Version of the DataFrame held by the Snapshot */
+    class Version* version_;
+};
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <stdint.h>
+#include "string.h"
+#include "object.h"
+
+/**
+ * Optional counters for the operations of a DataFrame and its Columns: how many times each one
+ * was called, how many rows and bytes it touched, and a histogram of how long it took.
+ * 
+ * Profiling is only compiled in when DATAFRAME_PROFILE is defined (such as with
+ * -DDATAFRAME_PROFILE). Otherwise DF_PROFILE_SCOPE(...) compiles to nothing, no clock is ever
+ * read, and every count stays at 0.
+ * 
+ * Counters are plain integers that are only ever touched through the GCC/Clang atomic builtins:
+ * record(...) adds to them with __atomic_fetch_add(..., __ATOMIC_RELAXED), and the getters read
+ * them with __atomic_load_n(..., __ATOMIC_RELAXED), so operations running on many threads (such
+ * as a parallel query) are all counted, and a count is never torn. Relaxed order means the
+ * counters of one OpStats may be read mid-update relative to each other (calls() may already
+ * include a call whose rows() are not added yet), but each counter on its own is exact.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+/**
+ * The operations that are counted. Those without COLUMN_ are functions of a DataFrame, and
+ * those with COLUMN_ are functions of any of its Columns (OP_COLUMN_GET and OP_COLUMN_SET count
+ * the typed get(...) and set(...) of every Column type, one call per cell). OP_MAP counts both
+ * map(...) and pmap(...) of a DataFrame, while OP_COLUMN_MAP and OP_COLUMN_APPLY count the
+ * arithmetic of an IntColumn or FloatColumn (see kernels.h). OP_OPEN is counted into the Stats of
+ * the DataFrame that open(...) returns.
+ */
+enum Operation {
+    OP_GET,
+    OP_SET,
+    OP_ADD_ROW,
+    OP_ADD_ROW_AT,
+    OP_ADD_ROWS,
+    OP_REMOVE_ROW,
+    OP_COMPACT,
+    OP_INSERT,
+    OP_APPEND_ROWS,
+    OP_GET_ROW,
+    OP_QUERY,
+    OP_SELECT,
+    OP_GROUP_BY,
+    OP_JOIN,
+    OP_SORT,
+    OP_PRINT,
+    OP_FILTER,
+    OP_VIEW,
+    OP_MAP,
+    OP_SNAPSHOT,
+    OP_COMPRESS,
+    OP_SAVE,
+    OP_OPEN,
+    OP_COLUMN_ADD_ROW,
+    OP_COLUMN_ADD_ROW_AT,
+    OP_COLUMN_REMOVE_ROW,
+    OP_COLUMN_APPEND,
+    OP_COLUMN_GATHER,
+    OP_COLUMN_MATCH,
+    OP_COLUMN_GET,
+    OP_COLUMN_SET,
+    OP_COLUMN_MAP,
+    OP_COLUMN_APPLY,
+    OP_COLUMN_COMPRESS,
+    NUM_OPERATIONS
+};
+
+/**
+ * The counters of one Operation.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class OpStats : public Object {
+    public:
+    /* The number of histogram buckets, bucket b counts calls that took [2^b, 2^(b+1)) ns */
+    static const size_t NUM_BUCKETS = 48;
+
+    /* Constructs an OpStats with every counter at 0 */
+    OpStats();
+
+    /* Deconstructs the OpStats */
+    ~OpStats();
+
+    /**
+     * Counts one call of the Operation.
+     * 
+     * @param rows - The number of rows the call touched
+     * @param bytes - The number of bytes the call allocated
+     * @param nanos - How long the call took, in nanoseconds
+     */
+    void record(size_t rows, size_t bytes, uint64_t nanos);
+
+    /* Returns the number of calls counted */
+    size_t calls();
+
+    /* Returns the total number of rows touched by every call */
+    size_t rows();
+
+    /* Returns the total number of bytes allocated by every call */
+    size_t bytes();
+
+    /* Returns the total time taken by every call, in nanoseconds */
+    uint64_t total_nanos();
+
+    /**
+     * Gets the number of calls inside of a histogram bucket.
+     * 
+     * NOTE: If the bucket is out of bounds, then an "error" will be thrown.
+     * 
+     * @param bucket - The numbered bucket (starting from 0)
+     * @return The number of calls that took [2^bucket, 2^(bucket+1)) ns
+     */
+    size_t bucket(size_t bucket);
+
+    /**
+     * Estimates a percentile of the time taken by a call from the histogram.
+     * 
+     * @param percentile - The percentile to be estimated, between 0 and 100 (such as 99)
+     * @return The upper bound of the bucket holding the percentile, in nanoseconds, or 0 if no
+     * calls were counted
+     */
+    uint64_t percentile(double percentile);
+
+    /* Sets every counter back to 0, with a relaxed __atomic_store_n(...) for each */
+    void reset();
+
+    protected:
+    /* The counters, only read and written with the __atomic builtins (see above) */
+    size_t calls_;
+    size_t rows_;
+    size_t bytes_;
+    uint64_t nanos_;
+    size_t buckets_[NUM_BUCKETS];
+};
+
+/**
+ * The counters of every Operation of a DataFrame and its Columns, returned by
+ * DataFrame::stats().
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Stats : public Object {
+    public:
+    /* Constructs a Stats with every counter at 0 */
+    Stats();
+
+    /* Deconstructs the Stats */
+    ~Stats();
+
+    /**
+     * Gets the counters of an Operation.
+     * 
+     * @param op - The Operation, which must not be NUM_OPERATIONS
+     * @return The OpStats owned by the Stats
+     */
+    OpStats* get(Operation op);
+
+    /**
+     * Gets the name of an Operation, which is its enumerator in lower case without "OP_", such
+     * as "query", "snapshot" or "column_remove_row".
+     * 
+     * @param op - The Operation, which must not be NUM_OPERATIONS
+     * @return The name, which must not be freed
+     */
+    static const char* name(Operation op);
+
+    /* Sets every counter of every Operation back to 0 */
+    void reset();
+
+    /**
+     * Creates a text table of every Operation that was called at least once, one per line, with
+     * its calls, rows, bytes, total time, and p50/p99 time.
+     * 
+     * @return A new String, so care should be taken to delete it
+     */
+    String* to_text();
+
+    /**
+     * Creates a JSON object with one key per Operation name, each holding an object with the
+     * keys "calls", "rows", "bytes", "total_ns", "p50_ns", "p99_ns" and "histogram" (the
+     * array of NUM_BUCKETS bucket counts).
+     * 
+     * @return A new String, so care should be taken to delete it
+     */
+    String* to_json();
+
+    /* Prints to_text() into the console */
+    void print();
+
+    protected:
+    /* The counters of each Operation */
+    OpStats ops_[NUM_OPERATIONS];
+};
+
+/**
+ * Times an Operation from its construction to its destruction, and records it into a Stats.
+ * Made by DF_PROFILE_SCOPE(...) at the start of each profiled function.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class ProfileScope {
+    public:
+    /**
+     * Starts timing an Operation.
+     * 
+     * @param stats - The Stats to record into, or nullptr to record nothing
+     * @param op - The Operation being timed
+     * @param rows - The number of rows the Operation touches
+     */
+    ProfileScope(Stats* stats, Operation op, size_t rows);
+
+    /* Stops timing, and records the Operation */
+    ~ProfileScope();
+
+    /**
+     * Sets the Stats to record into, for an Operation whose Stats only exists once it has
+     * started (such as OP_OPEN, whose DataFrame is made partway through). The time still counts
+     * from the construction of the ProfileScope.
+     * 
+     * @param stats - The Stats to record into, or nullptr to record nothing
+     */
+    void set_stats(Stats* stats);
+
+    /**
+     * Adds to the number of bytes the Operation allocated.
+     * 
+     * @param bytes - The number of bytes allocated
+     */
+    void add_bytes(size_t bytes);
+
+    protected:
+    /* What is recorded when the ProfileScope is destroyed */
+    Stats* stats_;
+    Operation op_;
+    size_t rows_;
+    size_t bytes_;
+
+    /* The monotonic clock time the ProfileScope was made, in nanoseconds */
+    uint64_t start_;
+};
+
+#ifdef DATAFRAME_PROFILE
+#define DF_PROFILE_SCOPE(stats, op, rows) ProfileScope df_profile_scope_((stats), (op), (rows))
+#define DF_PROFILE_BYTES(bytes) df_profile_scope_.add_bytes(bytes)
+#define DF_PROFILE_STATS(stats) df_profile_scope_.set_stats(stats)
+#else
+#define DF_PROFILE_SCOPE(stats, op, rows)
+#define DF_PROFILE_BYTES(bytes)
+#define DF_PROFILE_STATS(stats)
+#endif
@@ -2,15 +2,24 @@
 #pragma once
 
 #include "object.h"
+#include "arena.h"
 #include <cstdlib>
 #include <cstring>
 #include <cstdio> 
 
 /**
  * An immutable String class representing a char*
+ * 
+ * Strings shorter than INLINE_SIZE characters are stored inside of the String itself, and longer
+ * ones on the heap (or in an Arena). The length and hash are computed once on construction, so
+ * size() and hash() are O(1), and equals(...) rejects Strings of a different length or hash
+ * before comparing any characters.
  * author: chasebish */
 class String : public Object {
 public:
+  /* The number of bytes stored inline, so Strings of up to INLINE_SIZE - 1 characters fit */
+  static const size_t INLINE_SIZE = 16;
+
   /** CONSTRUCTORS & DESTRUCTORS **/
 
   /* Creates a String copying s */
@@ -18,17 +27,21 @@ public:
 
   /* Copies a String copying the value from s */
   String(String* const s);
+
+  /* Creates a String copying s into an Arena, for use as: new (arena) String(arena, s) */
+  String(Arena* arena, const char* s);
   
-  /* Clears String from memory */
+  /* Clears String from memory, the characters of an Arena String are left to its Arena */
   ~String();
 
 
   /** INHERITED METHODS **/
 
-  /* Inherited from Object, generates a hash for a String */
+  /* Inherited from Object, returns the hash of a String computed on construction */
   size_t hash();
 
-  /* Inherited from Object, checks equality between an String and an Object */
+  /* Inherited from Object, checks equality between an String and an Object, comparing the
+   * lengths and hashes before any characters */
   bool equals(Object* const obj);
 
 
@@ -44,6 +57,28 @@ public:
   /* Creates a new String by combining two existing Strings */
   String* concat(String* const s);
 
-  /* Returns the current length of the String */
+  /* Creates a new String by combining two existing Strings, inside of an Arena */
+  String* concat(String* const s, Arena* arena);
+
+  /* Returns the current length of the String, which is stored and never recounted */
   size_t size();
+
+  /* Returns the characters of the String, followed by a '\0' */
+  const char* c_str();
+
+protected:
+  /* The number of characters, not counting the '\0' */
+  size_t size_;
+
+  /* The hash of the characters, computed on construction */
+  size_t hash_;
+
+  /* The characters, inline_ if size_ < INLINE_SIZE and ptr_ otherwise */
+  union {
+    char inline_[INLINE_SIZE];
+    char* ptr_;
+  };
+
+  /* Whether ptr_ was allocated on the heap, and is freed by the destructor */
+  bool owned_;
 };
@@ -0,0 +1,75 @@
+/**
+ * Tests that FloatColumn::to_int() gives the same ints on every ScanPath (see scan.h), saturates
+ * floats outside the range of an int, turns NaN into a missing cell, and keeps missing cells
+ * missing. IntColumn::to_float() must keep missing cells missing too.
+ * 
+ * Build and run (exits with 1 and prints every failed check):
+ *      g++ -std=c++11 -pthread tests/cast_float.cpp <dataframe sources> -o cast_float
+ *      ./cast_float
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include "../column.h"
+#include "../scan.h"
+
+/* The number of failed checks */
+static int failures = 0;
+
+/* Counts and prints a failed check */
+void check(bool ok, const char* what, ScanPath path) {
+    if (!ok) {
+        fprintf(stderr, "FAILED (path %d): %s\n", (int)path, what);
+        failures++;
+    }
+}
+
+/* The floats converted, repeated so that every SIMD lane and the scalar tail see each of them */
+static const size_t NUM_FLOATS = 10;
+static const float FLOATS[NUM_FLOATS] = {2.7f, -2.7f, NAN, 1e10f, -1e10f, INFINITY, -INFINITY,
+    2147483520.0f, -2147483648.0f, 0.0f};
+static const int INTS[NUM_FLOATS] = {2, -2, 0, INT_MAX, INT_MIN, INT_MAX, INT_MIN, 2147483520,
+    INT_MIN, 0};
+
+/* Runs every check with one ScanPath */
+void test(ScanPath path) {
+    set_scan_path(path);
+    FloatColumn* fc = new FloatColumn();
+    for (size_t ii = 0; ii < 100; ii++) fc->append(&FLOATS[ii % NUM_FLOATS], 1);
+    fc->set_missing(99); /* 0.0, but missing */
+
+    IntColumn* ic = fc->to_int();
+    bool values = true;
+    bool missing = true;
+    for (size_t ii = 0; ii < 99; ii++) {
+        bool nan = isnan(FLOATS[ii % NUM_FLOATS]);
+        missing &= ic->is_missing(ii) == nan;
+        values &= ic->get(ii) == INTS[ii % NUM_FLOATS];
+    }
+    check(values, "every float converts to its saturated int", path);
+    check(missing, "only NaN cells become missing", path);
+    check(ic->is_missing(99), "a missing float stays missing", path);
+
+    FloatColumn* back = ic->to_float();
+    check(back->is_missing(2) && back->is_missing(99), "to_float() keeps missing cells", path);
+    check(!back->is_missing(0) && back->get(0) == 2.0f, "to_float() converts valid cells", path);
+
+    delete back;
+    delete ic;
+    delete fc;
+}
+
+int main() {
+    /* Every ScanPath up to the best one the CPU supports */
+    ScanPath best = get_scan_path();
+    test(SCALAR_SCAN);
+    if (best >= SSE2_SCAN) test(SSE2_SCAN);
+    if (best >= AVX2_SCAN) test(AVX2_SCAN);
+    printf("%s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
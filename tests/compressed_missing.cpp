@@ -0,0 +1,69 @@
+/**
+ * Tests that sum(), min() and max() of a compressed IntColumn skip missing cells, which hold 0
+ * (see the MISSING section of column.h) but must never be counted. Each chunk is compressed with
+ * a different encoding, so every path of CompressedChunk::sum(...) and min_max(...) is checked.
+ * 
+ * Build and run (exits with 1 and prints every failed check):
+ *      g++ -std=c++11 -pthread tests/compressed_missing.cpp <dataframe sources> -o compressed
+ *      ./compressed
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+#include <stdio.h>
+#include "../column.h"
+
+/* The number of failed checks */
+static int failures = 0;
+
+/* Counts and prints a failed check */
+void check(bool ok, const char* what) {
+    if (!ok) {
+        fprintf(stderr, "FAILED: %s\n", what);
+        failures++;
+    }
+}
+
+int main() {
+    size_t n = Column::CHUNK_SIZE;
+    int* values = new int[3 * n];
+    for (size_t ii = 0; ii < n; ii++) {
+        values[ii] = 50;                            /* one run, RLE_ENCODING */
+        values[n + ii] = 1000 + (int)(ii * 7 % 13); /* a small range, FOR_ENCODING */
+        values[2 * n + ii] = 1 + (int)ii;           /* steady steps, DELTA_ENCODING */
+    }
+    IntColumn* ic = new IntColumn();
+    ic->append(values, 3 * n);
+
+    /* Rows 100 to 199 of every chunk are missing, a single block so each encoding still wins */
+    int64_t expected = 0;
+    for (size_t ii = 0; ii < 3 * n; ii++) {
+        if (ii % n >= 100 && ii % n < 200) ic->set_missing(ii);
+        else expected += values[ii];
+    }
+    ic->compress();
+    check(ic->chunk_encoding(0) == RLE_ENCODING, "chunk 0 is RLE_ENCODING");
+    check(ic->chunk_encoding(1) == FOR_ENCODING, "chunk 1 is FOR_ENCODING");
+    check(ic->chunk_encoding(2) == DELTA_ENCODING, "chunk 2 is DELTA_ENCODING");
+
+    check(ic->sum() == expected, "sum() skips missing cells");
+    check(ic->min() == 1, "min() never sees the 0 of a missing cell");
+    check(ic->max() == (int)n, "max() of every chunk");
+
+    /* A chunk whose only valid cell is at its end, so a run is valid only in part */
+    IntColumn* sparse = new IntColumn();
+    sparse->append(values + n, n);
+    for (size_t ii = 0; ii + 1 < n; ii++) sparse->set_missing(ii);
+    sparse->compress();
+    check(sparse->sum() == values[2 * n - 1], "sum() of a chunk with one valid cell");
+    check(sparse->min() == values[2 * n - 1], "min() of a chunk with one valid cell");
+    check(sparse->max() == values[2 * n - 1], "max() of a chunk with one valid cell");
+
+    delete sparse;
+    delete ic;
+    delete[] values;
+    printf("%s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+/**
+ * Tests that SUM_AGG of an IntColumn in a GroupBy never overflows an int: the sums are kept in an
+ * int64_t and written to a FloatColumn, so a group whose sum is past INT_MAX still gets (close
+ * to) its real sum, the same as IntColumn::sum().
+ * 
+ * Build and run (exits with 1 and prints every failed check):
+ *      g++ -std=c++11 -pthread tests/groupby_sum.cpp <dataframe sources> -o groupby_sum
+ *      ./groupby_sum
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+#include <stdio.h>
+#include "../dataframe.h"
+#include "../groupby.h"
+
+/* The number of failed checks */
+static int failures = 0;
+
+/* Counts and prints a failed check */
+void check(bool ok, const char* what) {
+    if (!ok) {
+        fprintf(stderr, "FAILED: %s\n", what);
+        failures++;
+    }
+}
+
+int main() {
+    /* Group 0 sums to 3 * 2000000000, past INT_MAX, and group 1 to -3 * 2000000000 */
+    int keys[6] = {0, 1, 0, 1, 0, 1};
+    int values[6] = {2000000000, -2000000000, 2000000000, -2000000000, 2000000000, -2000000000};
+    IntColumn* key_col = new IntColumn();
+    key_col->append(keys, 6);
+    IntColumn* value_col = new IntColumn();
+    value_col->append(values, 6);
+    DataFrame* df = new DataFrame(key_col);
+    df->add_column(0, value_col);
+
+    size_t key_cols[1] = {0};
+    GroupBy* gb = df->group_by(key_cols, 1);
+    DataFrame* result = gb->agg(SUM_AGG, 1)->result();
+    check(result->nrow() == 2, "one row per group");
+    check(result->is_float_column(1), "SUM_AGG of an IntColumn is a FloatColumn");
+    if (result->nrow() == 2 && result->is_float_column(1)) {
+        check(result->get_float(0, 1) == (float)(3 * 2000000000LL), "group 0 does not wrap");
+        check(result->get_float(1, 1) == (float)(-3 * 2000000000LL), "group 1 does not wrap");
+        check((double)result->get_float(0, 1) + result->get_float(1, 1) == value_col->sum(),
+            "the group sums add up to IntColumn::sum()");
+    }
+
+    delete result;
+    delete gb;
+    delete df;
+    delete key_col;
+    delete value_col;
+    printf("%s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
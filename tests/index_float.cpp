@@ -0,0 +1,69 @@
+/**
+ * Tests that an indexed query(...) on a FloatColumn gives exactly the rows of a scan, which
+ * compares with IEEE ==: 0.0 and -0.0 find each other, and NaN finds nothing (not even a NaN
+ * cell). Both kinds of ColumnIndex are checked against the scan.
+ * 
+ * Build and run (exits with 1 and prints every failed check):
+ *      g++ -std=c++11 -pthread tests/index_float.cpp <dataframe sources> -o index_float
+ *      ./index_float
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include "../dataframe.h"
+
+/* The number of failed checks */
+static int failures = 0;
+
+/* Gives the number of rows query(0, value) finds */
+size_t count(DataFrame* df, float value) {
+    DataFrame* found = df->query(0, value);
+    size_t rows = found->nrow();
+    delete found;
+    return rows;
+}
+
+/* Compares the rows found with and without a ColumnIndex for one value */
+void check(DataFrame* scan, DataFrame* indexed, float value, size_t expected, const char* what) {
+    size_t scanned = count(scan, value);
+    size_t found = count(indexed, value);
+    if (scanned != expected || found != expected) {
+        fprintf(stderr, "FAILED: %s (scan %zu, index %zu, expected %zu)\n", what, scanned, found,
+            expected);
+        failures++;
+    }
+}
+
+int main() {
+    /* Each of 0.0, -0.0, NaN and 1.5 is in 25 rows */
+    float cells[4] = {0.0f, -0.0f, NAN, 1.5f};
+    float values[100];
+    for (int ii = 0; ii < 100; ii++) values[ii] = cells[ii % 4];
+
+    IndexKind kinds[2] = {HASH_INDEX, SORTED_INDEX};
+    for (int kk = 0; kk < 2; kk++) {
+        FloatColumn* plain = new FloatColumn();
+        plain->append(values, 100);
+        FloatColumn* keyed = new FloatColumn();
+        keyed->append(values, 100);
+        DataFrame* scan = new DataFrame(plain);
+        DataFrame* indexed = new DataFrame(keyed);
+        indexed->create_index(0, kinds[kk]);
+
+        check(scan, indexed, 0.0f, 50, "0.0 finds 0.0 and -0.0");
+        check(scan, indexed, -0.0f, 50, "-0.0 finds 0.0 and -0.0");
+        check(scan, indexed, NAN, 0, "NaN finds nothing");
+        check(scan, indexed, 1.5f, 25, "1.5 finds only 1.5");
+
+        delete scan;
+        delete indexed;
+        delete plain;
+        delete keyed;
+    }
+    printf("%s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+/**
+ * Tests that a ColumnIndex never finds missing cells (see the MISSING section of column.h), even
+ * though they hold the same 0 as the real 0 cells next to them, so that an indexed query(...)
+ * gives exactly the rows of a scan. Both kinds of ColumnIndex are checked, on rows that are
+ * built into the index and on rows appended to it afterwards.
+ * 
+ * Build and run (exits with 1 and prints every failed check):
+ *      g++ -std=c++11 -pthread tests/index_missing.cpp <dataframe sources> -o index_missing
+ *      ./index_missing
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+#include <stdio.h>
+#include "../dataframe.h"
+
+/* The number of failed checks */
+static int failures = 0;
+
+/* Counts and prints a failed check */
+void check(bool ok, const char* what, IndexKind kind) {
+    if (!ok) {
+        fprintf(stderr, "FAILED (%s): %s\n", kind == HASH_INDEX ? "HASH_INDEX" : "SORTED_INDEX",
+            what);
+        failures++;
+    }
+}
+
+/* Gives the number of rows query(0, 0) finds */
+size_t count_zeros(DataFrame* df) {
+    DataFrame* found = df->query(0, 0);
+    size_t rows = found->nrow();
+    delete found;
+    return rows;
+}
+
+/* Runs every check with one kind of ColumnIndex */
+void test(IndexKind kind) {
+    /* Rows 0, 3, 6, ... hold a real 0, rows 1, 4, 7, ... are missing, the rest hold 1 */
+    int values[300];
+    for (int ii = 0; ii < 300; ii++) values[ii] = ii % 3 == 2 ? 1 : 0;
+    IntColumn* ic = new IntColumn();
+    ic->append(values, 300);
+    DataFrame* df = new DataFrame(ic);
+    for (size_t row = 1; row < 300; row += 3) df->set_missing(row, 0);
+    size_t scanned = count_zeros(df);
+    check(scanned == 100, "a scan finds only the real 0 cells", kind);
+
+    df->create_index(0, kind);
+    check(count_zeros(df) == scanned, "the built index agrees with the scan", kind);
+    size_t num_rows = 0;
+    size_t* rows = df->get_index(0)->lookup(0, &num_rows);
+    bool any_missing = false;
+    for (size_t ii = 0; ii < num_rows; ii++) any_missing |= df->is_missing(rows[ii], 0);
+    check(num_rows == 100 && !any_missing, "lookup(0) skips the missing cells", kind);
+    delete[] rows;
+
+    /* Appended rows: one missing, one real 0 */
+    df->add_row();
+    df->set_missing(df->nrow() - 1, 0);
+    df->add_row();
+    df->set(df->nrow() - 1, 0, 0);
+    check(count_zeros(df) == scanned + 1, "appended missing cells are not indexed", kind);
+
+    delete df;
+    delete ic;
+}
+
+int main() {
+    test(HASH_INDEX);
+    test(SORTED_INDEX);
+    printf("%s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
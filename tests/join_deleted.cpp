@@ -0,0 +1,77 @@
+/**
+ * Tests that every JoinStrategy skips deleted rows (see the DELETION section of dataframe.h),
+ * and pairs up the right rows when the left DataFrame still holds tombstoned rows that have not
+ * been compacted away. Each left key k must be joined to the right row holding 10 * k.
+ * 
+ * Build and run (exits with 1 and prints every failed check):
+ *      g++ -std=c++11 -pthread tests/join_deleted.cpp <dataframe sources> -o join_deleted
+ *      ./join_deleted
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+#include <stdio.h>
+#include "../dataframe.h"
+#include "../join.h"
+
+/* The number of failed checks */
+static int failures = 0;
+
+/* Counts and prints a failed check */
+void check(bool ok, const char* what, const char* strategy) {
+    if (!ok) {
+        fprintf(stderr, "FAILED (%s): %s\n", strategy, what);
+        failures++;
+    }
+}
+
+int main() {
+    int keys[1000];
+    int tens[1000];
+    for (int ii = 0; ii < 1000; ii++) {
+        keys[ii] = 999 - ii;
+        tens[ii] = 10 * (999 - ii);
+    }
+    IntColumn* left_keys = new IntColumn();
+    left_keys->append(keys, 1000);
+    DataFrame* left = new DataFrame(left_keys);
+    left->set_compaction_threshold(1);
+    /* Deleting every third row from the end keeps the logical and physical rows apart */
+    for (size_t row = 999; row > 0; row -= 3) left->remove_row(row);
+
+    IntColumn* right_keys = new IntColumn();
+    right_keys->append(keys, 1000);
+    IntColumn* right_tens = new IntColumn();
+    right_tens->append(tens, 1000);
+    DataFrame* right = new DataFrame(right_keys);
+    right->add_column(0, right_tens);
+
+    JoinStrategy strategies[3] = {HASH_JOIN, RADIX_JOIN, SORT_MERGE_JOIN};
+    const char* names[3] = {"HASH_JOIN", "RADIX_JOIN", "SORT_MERGE_JOIN"};
+    for (int ss = 0; ss < 3; ss++) {
+        Join* join = new Join(left, right, INNER_JOIN);
+        join->set_strategy(strategies[ss]);
+        DataFrame* joined = join->on(0, 0)->result();
+        check(joined->nrow() == left->nrow(), "one row for each live left row", names[ss]);
+        bool paired = true;
+        bool live = true;
+        for (size_t row = 0; row < joined->nrow(); row++) {
+            paired &= joined->get_int(row, 1) == 10 * joined->get_int(row, 0);
+            live &= joined->get_int(row, 0) % 3 != 0;
+        }
+        check(paired, "each key is joined to its own right row", names[ss]);
+        check(live, "no deleted key (a multiple of 3) is joined", names[ss]);
+        delete joined;
+        delete join;
+    }
+
+    delete left;
+    delete right;
+    delete left_keys;
+    delete right_keys;
+    delete right_tens;
+    printf("%s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
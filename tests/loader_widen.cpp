@@ -0,0 +1,96 @@
+/**
+ * Tests that a Loader widens a column whose fields after the sampled rows do not fit its inferred
+ * type (see the WIDENING section of loader.h), instead of failing the load. The file is split into
+ * many small pieces parsed on a ThreadPool, so the late fields land in a different piece from the
+ * sample, and every cell before them is checked to have been parsed again as the wider type.
+ * 
+ * Build and run (exits with 1 and prints every failed check):
+ *      g++ -std=c++11 -pthread tests/loader_widen.cpp <dataframe sources> -o loader_widen
+ *      ./loader_widen
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "../loader.h"
+
+/* The number of failed checks */
+static int failures = 0;
+
+/* The number of rows of the file, and the rows holding the out-of-sample fields */
+static const size_t ROWS = 5000;
+static const size_t LATE_FLOAT = 3000;
+static const size_t LATE_STRING = 4999;
+static const size_t LATE_INT = 2000;
+
+/* Counts and prints a failed check */
+void check(bool ok, const char* what) {
+    if (!ok) {
+        fprintf(stderr, "FAILED: %s\n", what);
+        failures++;
+    }
+}
+
+int main() {
+    /* Column 0 is int until a late 2.5, column 1 is int until a late "abc", column 2 is bool
+       until a late 7, and column 3 is int all the way through */
+    char path[] = "/tmp/loader_widen_XXXXXX";
+    int fd = mkstemp(path);
+    FILE* out = fdopen(fd, "w");
+    for (size_t ii = 0; ii < ROWS; ii++) {
+        if (ii == LATE_FLOAT) fprintf(out, "2.5,");
+        else fprintf(out, "%zu,", ii);
+        if (ii == LATE_STRING) fprintf(out, "abc,");
+        else fprintf(out, "%zu,", ii);
+        if (ii == LATE_INT) fprintf(out, "7,");
+        else fprintf(out, "%d,", (int)(ii % 2));
+        fprintf(out, "%zu\n", ii * 3);
+    }
+    fclose(out);
+
+    ThreadPool* pool = new ThreadPool(4);
+    Loader* loader = new Loader(path);
+    loader->set_sample_rows(100);
+    loader->set_chunk_bytes(4096);
+    loader->set_thread_pool(pool);
+    loader->infer_types();
+    check(loader->get_type(0) == INT_TAG, "column 0 is inferred as int from the sample");
+    check(loader->get_type(2) == BOOL_TAG, "column 2 is inferred as bool from the sample");
+
+    DataFrame* df = loader->load();
+    check(df->nrow() == ROWS, "every row is loaded");
+    check(loader->get_type(0) == FLOAT_TAG && df->is_float_column(0), "column 0 widens to float");
+    check(loader->get_type(1) == STRING_TAG && df->is_string_column(1),
+        "column 1 widens to String");
+    check(loader->get_type(2) == INT_TAG && df->is_int_column(2), "column 2 widens to int");
+    check(loader->get_type(3) == INT_TAG && df->is_int_column(3), "column 3 stays int");
+
+    bool floats = true, strings = true, ints = true, kept = true;
+    char expected[32];
+    for (size_t ii = 0; ii < ROWS; ii++) {
+        float value = ii == LATE_FLOAT ? 2.5f : (float)ii;
+        if (df->get_float(ii, 0) != value) floats = false;
+        if (ii == LATE_STRING) snprintf(expected, sizeof(expected), "abc");
+        else snprintf(expected, sizeof(expected), "%zu", ii);
+        String* field = new String(expected);
+        if (!df->get_string(ii, 1)->equals(field)) strings = false;
+        delete field;
+        if (df->get_int(ii, 2) != (ii == LATE_INT ? 7 : (int)(ii % 2))) ints = false;
+        if (df->get_int(ii, 3) != (int)(ii * 3)) kept = false;
+    }
+    check(floats, "every cell of column 0 holds its value as a float");
+    check(strings, "every cell of column 1 holds its field as a String");
+    check(ints, "every cell of column 2 holds its value as an int");
+    check(kept, "every cell of column 3 is unchanged");
+
+    delete df;
+    delete loader;
+    delete pool;
+    unlink(path);
+    printf("%s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,205 @@
+/**
+ * Stress test of Snapshots (see snapshot.h): one writer thread keeps changing a DataFrame while
+ * reader threads check that every Snapshot they take is consistent.
+ * 
+ * Every row the writer makes holds a pair (a, 2 * a) in columns 0 and 1, and the String "k" + (a %
+ * KEYS) in column 2, and the writer changes the cells of a row only in between publish() calls.
+ * Every few rows the writer also marks all three cells of a row missing, deletes a row, or
+ * rewrites an old row with a new pair. So a reader must always see, in every row of a Snapshot:
+ *      - columns 0 and 1 both missing or both holding a value, with column 1 twice column 0
+ *      - column 2 missing exactly when column 0 is, and otherwise "k" + (column 0 % KEYS)
+ * filter(...) on the Snapshot must also agree with a plain scan of its cells.
+ * 
+ * Row 0 is never deleted, blanked or rewritten at random. Before each publish() the writer sets
+ * it to (d, 2 * d) where d is the number of rows it has deleted so far, so every Snapshot carries
+ * the delete count of its own Version. Between two Snapshots taken by one reader, d must never go
+ * down, and nrow() must never go down by more than the rows deleted in between.
+ * 
+ * Build and run (exits with 1 and prints the first broken row if anything is inconsistent):
+ *      g++ -std=c++11 -O2 -pthread tests/snapshot_stress.cpp <dataframe sources> -o stress
+ *      ./stress [seconds] [readers]
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../dataframe.h"
+#include "../predicate.h"
+#include "../snapshot.h"
+
+/* The number of distinct Strings of column 2 */
+static const int KEYS = 97;
+
+/* The number of rows the writer changes between each publish() */
+static const int ROWS_PER_PUBLISH = 64;
+
+/* Set once the test is over, and read by every thread */
+static int done = 0;
+
+/* Set by the first thread to find an inconsistent Snapshot */
+static int failed = 0;
+
+/* Fills buffer with the String expected in column 2 for a */
+void key_for(int a, char* buffer, size_t size) {
+    snprintf(buffer, size, "k%d", a % KEYS);
+}
+
+/* Reports a broken row of a Snapshot, and stops the test */
+void fail(const char* why, size_t row, int a, int b) {
+    if (__atomic_exchange_n(&failed, 1, __ATOMIC_ACQ_REL) == 0) {
+        fprintf(stderr, "inconsistent snapshot: %s at row %zu (a = %d, b = %d)\n", why, row, a,
+            b);
+    }
+    __atomic_store_n(&done, 1, __ATOMIC_RELEASE);
+}
+
+/* Writes one row (a, 2 * a, key) at a row of the DataFrame */
+void write_row(DataFrame* df, size_t row, int a) {
+    char buffer[32];
+    key_for(a, buffer, sizeof(buffer));
+    String* key = new String(buffer);
+    df->set(row, 0, a);
+    df->set(row, 1, 2 * a);
+    df->set(row, 2, key);
+    delete key;
+}
+
+/* Keeps appending, rewriting, deleting and blanking rows, publishing every ROWS_PER_PUBLISH */
+void* writer(void* arg) {
+    DataFrame* df = (DataFrame*)arg;
+    unsigned int seed = 1;
+    int next = 0;
+    int deleted = 0;
+    while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+        for (int ii = 0; ii < ROWS_PER_PUBLISH; ii++) {
+            int choice = rand_r(&seed) % 16;
+            if (choice == 0 && df->nrow() > 1) {
+                df->remove_row(1 + rand_r(&seed) % (df->nrow() - 1));
+                deleted++;
+            } else if (choice == 1 && df->nrow() > 1) {
+                size_t row = 1 + rand_r(&seed) % (df->nrow() - 1);
+                df->set_missing(row, 0);
+                df->set_missing(row, 1);
+                df->set_missing(row, 2);
+            } else if (choice == 2 && df->nrow() > 1) {
+                write_row(df, 1 + rand_r(&seed) % (df->nrow() - 1), next++);
+            } else {
+                df->add_row();
+                write_row(df, df->nrow() - 1, next++);
+            }
+        }
+        write_row(df, 0, deleted);
+        df->publish();
+    }
+    return nullptr;
+}
+
+/* Checks every row of a Snapshot, returning the number of rows with column 0 below 1000 */
+size_t check_rows(Snapshot* snap) {
+    char buffer[32];
+    size_t small = 0;
+    for (size_t row = 0; row < snap->nrow(); row++) {
+        bool missing_a = snap->is_missing(row, 0);
+        if (missing_a != snap->is_missing(row, 1) || missing_a != snap->is_missing(row, 2)) {
+            fail("cells of a row disagree on being missing", row, 0, 0);
+            return 0;
+        }
+        if (missing_a) continue;
+        int a = snap->get_int(row, 0);
+        int b = snap->get_int(row, 1);
+        if (b != 2 * a) {
+            fail("column 1 is not twice column 0", row, a, b);
+            return 0;
+        }
+        key_for(a, buffer, sizeof(buffer));
+        String* key = snap->get_string(row, 2);
+        if (key == nullptr || strcmp(key->c_str(), buffer) != 0) {
+            fail("column 2 does not match column 0", row, a, b);
+            return 0;
+        }
+        if (a < 1000) small++;
+    }
+    return small;
+}
+
+/* Keeps taking Snapshots and checking them until the test is over */
+void* reader(void* arg) {
+    DataFrame* df = (DataFrame*)arg;
+    Predicate* below = new Predicate(0, LESS_COMPARE, 1000);
+    size_t checked = 0;
+    size_t last_nrow = 0;
+    int last_deleted = 0;
+    while (!__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+        Snapshot* snap = df->snapshot();
+        int deleted = snap->get_int(0, 0);
+        if (deleted < last_deleted) {
+            fail("the delete count of row 0 went down", 0, deleted, last_deleted);
+        } else if (snap->nrow() + (size_t)(deleted - last_deleted) < last_nrow) {
+            fail("nrow() went down by more than the rows deleted", snap->nrow(), deleted,
+                last_deleted);
+        }
+        last_nrow = snap->nrow();
+        last_deleted = deleted;
+        size_t small = check_rows(snap);
+        Bitmap* matches = snap->filter(below);
+        if (!__atomic_load_n(&failed, __ATOMIC_ACQUIRE) && matches->count() != small) {
+            fail("filter(...) disagrees with the cells", 0, (int)matches->count(), (int)small);
+        }
+        delete matches;
+        delete snap;
+        checked++;
+    }
+    delete below;
+    return (void*)checked;
+}
+
+int main(int argc, char** argv) {
+    int seconds = argc > 1 ? atoi(argv[1]) : 10;
+    int num_readers = argc > 2 ? atoi(argv[2]) : 4;
+
+    IntColumn* a = new IntColumn();
+    IntColumn* b = new IntColumn();
+    StringColumn* key = new StringColumn();
+    key->encode();
+    DataFrame* df = new DataFrame(a);
+    df->add_column(0, b);
+    df->add_column(1, key);
+    df->add_row();
+    write_row(df, 0, 0);
+    df->publish();
+
+    pthread_t write_thread;
+    pthread_t* read_threads = new pthread_t[num_readers];
+    pthread_create(&write_thread, nullptr, writer, df);
+    for (int ii = 0; ii < num_readers; ii++) {
+        pthread_create(&read_threads[ii], nullptr, reader, df);
+    }
+    for (int ii = 0; ii < seconds * 10 && !__atomic_load_n(&done, __ATOMIC_ACQUIRE); ii++) {
+        usleep(100 * 1000);
+    }
+    __atomic_store_n(&done, 1, __ATOMIC_RELEASE);
+
+    size_t checked = 0;
+    pthread_join(write_thread, nullptr);
+    for (int ii = 0; ii < num_readers; ii++) {
+        void* result;
+        pthread_join(read_threads[ii], &result);
+        checked += (size_t)result;
+    }
+    printf("%s: %zu snapshots checked, %zu rows written\n", failed ? "FAILED" : "passed",
+        checked, df->nrow());
+
+    delete[] read_threads;
+    delete df;
+    delete a;
+    delete b;
+    delete key;
+    return failed ? 1 : 0;
+}
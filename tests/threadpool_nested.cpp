@@ -0,0 +1,97 @@
+/**
+ * Tests that ThreadPool::run_all(...) called from inside a Task of the same ThreadPool runs its
+ * Tasks inline instead of deadlocking, even when every thread of the ThreadPool is busy with an
+ * outer Task at once. The test fails (instead of hanging) if it is not done after 10 seconds.
+ * 
+ * Build and run (exits with 1 and prints every failed check):
+ *      g++ -std=c++11 -pthread tests/threadpool_nested.cpp <dataframe sources> -o threadpool_nested
+ *      ./threadpool_nested
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "../threadpool.h"
+
+/* The number of failed checks */
+static int failures = 0;
+
+/* Counts and prints a failed check */
+void check(bool ok, const char* what) {
+    if (!ok) {
+        fprintf(stderr, "FAILED: %s\n", what);
+        failures++;
+    }
+}
+
+/* Called if the Tasks have not finished in time, which means run_all(...) deadlocked */
+void timed_out(int signal) {
+    (void)signal;
+    fprintf(stderr, "FAILED: nested run_all(...) deadlocked\n");
+    _exit(1);
+}
+
+/* Counts one run, and whether it ran on a thread of the ThreadPool */
+class InnerTask : public Task {
+    public:
+    ThreadPool* pool;
+    size_t* runs;
+    size_t* inline_runs;
+
+    void run() {
+        __atomic_fetch_add(this->runs, 1, __ATOMIC_RELAXED);
+        if (this->pool->on_own_thread()) __atomic_fetch_add(this->inline_runs, 1, __ATOMIC_RELAXED);
+    }
+};
+
+/* Runs INNER InnerTasks on the same ThreadPool it is itself running on */
+class OuterTask : public Task {
+    public:
+    static const size_t INNER = 8;
+    ThreadPool* pool;
+    size_t* runs;
+    size_t* inline_runs;
+
+    void run() {
+        InnerTask inner[INNER];
+        Task* tasks[INNER];
+        for (size_t ii = 0; ii < INNER; ii++) {
+            inner[ii].pool = this->pool;
+            inner[ii].runs = this->runs;
+            inner[ii].inline_runs = this->inline_runs;
+            tasks[ii] = &inner[ii];
+        }
+        this->pool->run_all(tasks, INNER);
+    }
+};
+
+int main() {
+    signal(SIGALRM, timed_out);
+    alarm(10);
+
+    /* Twice as many outer Tasks as threads, so every thread waits inside run_all(...) at once */
+    ThreadPool* pool = new ThreadPool(4);
+    size_t runs = 0;
+    size_t inline_runs = 0;
+    OuterTask outer[8];
+    Task* tasks[8];
+    for (size_t ii = 0; ii < 8; ii++) {
+        outer[ii].pool = pool;
+        outer[ii].runs = &runs;
+        outer[ii].inline_runs = &inline_runs;
+        tasks[ii] = &outer[ii];
+    }
+    check(!pool->on_own_thread(), "the main thread is not a thread of the ThreadPool");
+    pool->run_all(tasks, 8);
+    check(runs == 8 * OuterTask::INNER, "every inner Task ran once");
+    check(inline_runs == runs, "every inner Task ran inline on a thread of the ThreadPool");
+
+    delete pool;
+    printf("%s\n", failures == 0 ? "passed" : "FAILED");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "object.h"
+
+/**
+ * A unit of work that can be run by a ThreadPool.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class Task : public Object {
+    public:
+    /**
+     * Runs the Task on one of the threads of a ThreadPool.
+     * 
+     * NOTE: The default behavior of this function will be to throw an error, it must be
+     * overriden by subclasses.
+     */
+    virtual void run();
+};
+
+/**
+ * A fixed number of threads that run Tasks, used to split work such as DataFrame::query(...)
+ * across cores.
+ * 
+ * Each thread has its own queue of Tasks. Tasks given to run_all(...) are spread evenly across the
+ * queues, and a thread that runs out of Tasks steals from the back of another thread's queue, so
+ * that all threads stay busy even when some Tasks take longer than others.
+ * 
+ * NESTING: Columns share the ThreadPool of their DataFrame, so run_all(...) can be called from a
+ * Task that is already running on the ThreadPool (such as FloatColumn::sum() inside a Rower of
+ * DataFrame::pmap(...)). Queueing those Tasks and waiting could deadlock, as every thread could
+ * be waiting for Tasks that no free thread is left to run. So each thread of a ThreadPool records
+ * its ThreadPool in a thread-local pointer, and a run_all(...) called from one of its own threads
+ * runs every Task inline on the calling thread, one after another in order, before returning.
+ * A run_all(...) called from any other thread (including a thread of another ThreadPool) spreads
+ * the Tasks as usual.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class ThreadPool : public Object {
+    public:
+    /**
+     * Constructs a ThreadPool and starts its threads.
+     * 
+     * NOTE: If threads is 0, then an "error" will be thrown.
+     * 
+     * @param threads - The number of threads in the ThreadPool
+     */
+    ThreadPool(size_t threads);
+
+    /* Waits for any running Tasks to finish, then stops and deconstructs the threads */
+    ~ThreadPool();
+
+    /**
+     * Returns the number of threads inside of the ThreadPool.
+     * 
+     * @return The number of threads
+     */
+    size_t size();
+
+    /**
+     * Runs every Task on the threads of the ThreadPool, and waits for all of them to finish.
+     * Tasks may run in any order, and at the same time as each other. If called from one of the
+     * ThreadPool's own threads, the Tasks are instead run inline on that thread (see NESTING).
+     * 
+     * NOTE: The ThreadPool does not take ownership of the Tasks.
+     * 
+     * @param tasks - The Tasks to be run
+     * @param num_tasks - The number of Tasks inside of tasks
+     */
+    void run_all(Task** tasks, size_t num_tasks);
+
+    /**
+     * Checks whether the calling thread is one of the threads of this ThreadPool, which is when
+     * run_all(...) runs its Tasks inline.
+     * 
+     * @return True if called from inside a Task run by this ThreadPool, false otherwise
+     */
+    bool on_own_thread();
+
+    protected:
+    /* The number of threads inside of the ThreadPool */
+    size_t size_;
+
+    /* The per-thread state (thread handle and Task queue) of each thread */
+    class Worker** workers_;
+};
@@ -0,0 +1,289 @@
+#pragma once
+
+#include "string.h"
+#include "object.h"
+#include "bitmap.h"
+#include "dataframe.h"
+#include "predicate.h"
+
+/**
+ * A read-only view of some of the rows of a DataFrame. A DataFrameView does NOT copy any cells,
+ * it only holds a reference to its parent DataFrame and a selection vector of the parent's row
+ * indices, in the same order as the parent. This makes querying the result of another query
+ * (drilling down) cost only the size of the selection vector, instead of a copy of every cell.
+ * 
+ * Rows are numbered by their position in the view (starting from 0), and map to the parent row
+ * stored at that position of the selection vector. The selection vector holds physical rows of
+ * the parent (see the DELETION section of dataframe.h), so reading a cell never goes through the
+ * parent's rank directory. Columns are numbered the same as the parent.
+ * 
+ * A new DataFrame with the selected rows is only created when to_dataframe() is called.
+ * Example:
+ *      int ints[3] = {14, 4, 14};
+ *      bool flags[3] = {false, false, true};
+ *      IntColumn* ic = new IntColumn();
+ *      ic->append(ints, 3);
+ *      BoolColumn* bc = new BoolColumn();
+ *      bc->append(flags, 3);
+ *      DataFrame* df = new DataFrame(ic);
+ *      df->add_column(0, bc);
+ *      DataFrameView* all = df->view();
+ *      DataFrameView* fourteens = all->query(0, 14); // rows 0 and 2
+ *      DataFrameView* flagged = fourteens->query(1, true); // row 2
+ *      DataFrame* result = flagged->to_dataframe(); // cells are only copied here
+ * 
+ * CAUTION: A DataFrameView does not own its parent, and deleting it will not delete the parent.
+ * The parent MUST outlive every view of it, and any function that adds, removes, or inserts rows
+ * (other than at the end) of the parent will make the selection vector of its views invalid.
+ * 
+ * Authors: 
+ *      csstransky - stransky.c@husky.neu.edu
+ *      kaylindevchand - devchand.k@husky.neu.edu
+ */
+class DataFrameView : public Object {
+    public:
+    /**
+     * Creates a view of every row of a DataFrame.
+     * 
+     * @param parent - The DataFrame that is being viewed
+     */
+    DataFrameView(DataFrame* parent);
+
+    /**
+     * Creates a view of the rows of a DataFrame that are selected by a Bitmap.
+     * 
+     * NOTE: If the Bitmap is not the same size as the parent's nrow() + num_deleted(), then an
+     * "error" will be thrown. Deleted rows of the parent are never viewed.
+     * 
+     * @param parent - The DataFrame that is being viewed
+     * @param rows - The Bitmap with bit r set for every physical row r of the parent to be viewed
+     */
+    DataFrameView(DataFrame* parent, Bitmap* rows);
+
+    /**
+     * Deconstructs the DataFrameView and its selection vector, but NOT the parent DataFrame.
+     */
+    ~DataFrameView();
+
+    /**
+     * Determines if another object is equal to this one.
+     * 
+     * @param obj - The Object that will be compared 
+     * @return For a DataFrameView to equal another DataFrameView, both must have the same parent
+     * and the same selection vector.
+     */
+    bool equals(Object* const obj);
+
+    /**
+     * Prints a representation of the viewed rows into the console, in the same format as
+     * DataFrame::print().
+     */
+    void print();
+
+    /**
+     * Gets a String representation of a cell inside the view.
+     * 
+     * NOTE: If the choosen column is NOT an StringColumn, or row and column are out of bounds, 
+     * then an "error" should be thrown.
+     * 
+     * @param row - The numbered row of the view (starting from 0)
+     * @param column - The numbered column of the view (starting from 0)
+     * @return - A String* representation of the value inside of the cell
+     */
+    String* get_string(size_t row, size_t column);
+
+    /**
+     * Gets a Boolean representation of a cell inside the view.
+     * 
+     * NOTE: If the choosen column is NOT an BoolColumn, or row and column are out of bounds, 
+     * then an "error" should be thrown.
+     * 
+     * @param row - The numbered row of the view (starting from 0)
+     * @param column - The numbered column of the view (starting from 0)
+     * @return - A Boolean representation of the value inside of the cell
+     */
+    bool get_bool(size_t row, size_t column);
+
+    /**
+     * Gets an int representation of a cell inside the view.
+     * 
+     * NOTE: If the choosen column is NOT an IntColumn, or row and column are out of bounds, 
+     * then an "error" should be thrown.
+     * 
+     * @param row - The numbered row of the view (starting from 0)
+     * @param column - The numbered column of the view (starting from 0)
+     * @return - An int representation of the value inside of the cell
+     */
+    int get_int(size_t row, size_t column);
+
+    /**
+     * Gets a float representation of a cell inside the view.
+     * 
+     * NOTE: If the choosen column is NOT an FloatColumn, or row and column are out of bounds, 
+     * then an "error" should be thrown.
+     * 
+     * @param row - The numbered row of the view (starting from 0)
+     * @param column - The numbered column of the view (starting from 0)
+     * @return - A float representation of the value inside of the cell
+     */
+    float get_float(size_t row, size_t column);
+
+    /**
+     * Finds whether a cell of the view is missing (see DataFrame::is_missing(...)).
+     * 
+     * NOTE: If row and column are out of bounds, then an "error" will be thrown.
+     * 
+     * @param row - The numbered row of the view (starting from 0)
+     * @param column - The numbered column of the view (starting from 0)
+     * @return True if the cell has no value, false if it holds a value
+     */
+    bool is_missing(size_t row, size_t column);
+
+    /**
+     * The number of rows in the view.
+     * 
+     * @return The number of rows in the selection vector.
+     */
+    size_t nrow();
+
+    /**
+     * The number of columns in the view.
+     * 
+     * @return The number of columns in the parent DataFrame.
+     */
+    size_t ncol();
+
+    /**
+     * Gets the DataFrame that is being viewed.
+     * 
+     * @return The parent DataFrame
+     */
+    DataFrame* get_parent();
+
+    /**
+     * Gets the row index of the parent DataFrame that a row of the view maps to.
+     * 
+     * NOTE: If row is out of bounds, then an "error" will be thrown.
+     * 
+     * @param row - The numbered row of the view (starting from 0)
+     * @return The logical row of the parent DataFrame (starting from 0), found from the stored
+     * physical row with DataFrame::logical_row(...)
+     */
+    size_t get_parent_row(size_t row);
+
+    /**
+     * Gets a view of 1 row of this view, without copying any cells.
+     * 
+     * NOTE: If row is out of bounds, then an "error" will be thrown.
+     * 
+     * @param row - The numbered row of the view (starting from 0)
+     * @return A new DataFrameView of 1 row with the same parent
+     */
+    DataFrameView* get_row(size_t row);
+
+    /**
+     * Gets a view of the rows of this view that are selected by a Bitmap.
+     * 
+     * NOTE: If the Bitmap is not the same size as nrow(), then an "error" will be thrown.
+     * 
+     * @param rows - The Bitmap with bit r set for every row r of this view to be kept
+     * @return A new DataFrameView with the same parent
+     */
+    DataFrameView* select(Bitmap* rows);
+
+    /**
+     * Gets a view with all rows of this view matching the given string_value in the specified
+     * col index.
+     * 
+     * NOTE: If the col is out of bounds, or if the Column specified is not a StringColumn,
+     * then an "error" will be thrown.
+     * 
+     * @param col - The numbered column of the view (starting from 0)
+     * @param string_value - The String that will match with all the values queried
+     * @return A new DataFrameView with the same parent, the order of the rows will be the same
+     * as this view.
+     */
+    DataFrameView* query(size_t col, String* string_value);
+
+    /**
+     * Gets a view with all rows of this view matching the given bool_value in the specified
+     * col index.
+     * 
+     * NOTE: If the col is out of bounds, or if the Column specified is not a BoolColumn,
+     * then an "error" will be thrown.
+     * 
+     * @param col - The numbered column of the view (starting from 0)
+     * @param bool_value - The Boolean that will match with all the values queried
+     * @return A new DataFrameView with the same parent, the order of the rows will be the same
+     * as this view.
+     */
+    DataFrameView* query(size_t col, bool bool_value);
+
+    /**
+     * Gets a view with all rows of this view matching the given int_value in the specified
+     * col index.
+     * 
+     * NOTE: If the col is out of bounds, or if the Column specified is not an IntColumn,
+     * then an "error" will be thrown.
+     * 
+     * @param col - The numbered column of the view (starting from 0)
+     * @param int_value - The integer that will match with all the values queried
+     * @return A new DataFrameView with the same parent, the order of the rows will be the same
+     * as this view.
+     */
+    DataFrameView* query(size_t col, int int_value);
+
+    /**
+     * Gets a view with all rows of this view matching the given float_value in the specified
+     * col index.
+     * 
+     * NOTE: If the col is out of bounds, or if the Column specified is not a FloatColumn,
+     * then an "error" will be thrown.
+     * 
+     * @param col - The numbered column of the view (starting from 0)
+     * @param float_value - The float that will match with all the values queried
+     * @return A new DataFrameView with the same parent, the order of the rows will be the same
+     * as this view.
+     */
+    DataFrameView* query(size_t col, float float_value);
+
+    /**
+     * Gets a view with all rows of this view matching a Predicate. The Predicate is run as a
+     * FusedScan over only the rows of this view, producing one new selection vector.
+     * 
+     * NOTE: If predicate->check(...) on the parent is false, then an "error" will be thrown.
+     * 
+     * @param predicate - The Predicate to filter with, which is NOT owned by the view
+     * @return A new DataFrameView with the same parent, the order of the rows will be the same
+     * as this view.
+     */
+    DataFrameView* query(Predicate* predicate);
+
+    /**
+     * Creates a new DataFrame with a copy of every viewed row, in the order of the view. This is
+     * the only function of a DataFrameView that copies cells. The Column types and headers will
+     * be the same as the parent.
+     * 
+     * @return A new DataFrame, so care should be taken to delete it
+     */
+    DataFrame* to_dataframe();
+
+    protected:
+    /**
+     * Creates a view from an already built selection vector, taking ownership of it.
+     * 
+     * @param parent - The DataFrame that is being viewed
+     * @param rows - The parent row indices, in increasing order
+     * @param nrow - The number of row indices inside of rows
+     */
+    DataFrameView(DataFrame* parent, size_t* rows, size_t nrow);
+
+    /* The DataFrame that is being viewed */
+    DataFrame* parent_;
+
+    /* The selection vector of parent row indices, in increasing order */
+    size_t* rows_;
+
+    /* The number of row indices inside of rows_ */
+    size_t nrow_;
+};